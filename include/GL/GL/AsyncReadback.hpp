@@ -0,0 +1,84 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_ASYNCREADBACK_HPP
+#define OOGL_ASYNCREADBACK_HPP
+
+#include <GL/GL/VertexBuffer.hpp>
+#include <GL/GL/Framebuffer.hpp>
+#include <GL/GL/Fence.hpp>
+
+namespace GL
+{
+	/*
+		Asynchronous readback
+
+		GetSubData() and glReadPixels() into client memory make the CPU wait
+		until the GPU has caught up with everything before them. A readback
+		instead has the GPU copy the data into a buffer of its own and fences
+		the copy, so the request returns right away. Poll IsReady() once a
+		frame and only Map() or GetData() the result when it returns true,
+		mapping earlier waits for the copy. Starting a new read replaces the
+		previous one. Pixel rows are padded to 4 bytes, as glReadPixels does.
+	*/
+	class AsyncReadback
+	{
+	public:
+		AsyncReadback();
+
+		void Read( const VertexBuffer& source, size_t offset, size_t length );
+
+		void ReadColor( const Framebuffer& framebuffer, Format::format_t format = Format::RGBA, DataType::data_type_t type = DataType::UnsignedByte );
+		void ReadColor( const Framebuffer& framebuffer, uint x, uint y, uint width, uint height, Format::format_t format = Format::RGBA, DataType::data_type_t type = DataType::UnsignedByte );
+		void ReadDepth( const Framebuffer& framebuffer, DataType::data_type_t type = DataType::Float );
+		void ReadDepth( const Framebuffer& framebuffer, uint x, uint y, uint width, uint height, DataType::data_type_t type = DataType::Float );
+
+		bool IsPending() const { return pending; }
+		bool IsReady() const { return pending && fence.IsSignaled(); }
+		size_t GetSize() const { return size; }
+
+		const void* Map();
+		void Unmap();
+
+		// Copies the result out, returns false if there is none
+		bool GetData( void* data );
+
+		// Drops the result, IsPending() and IsReady() return false until the next read
+		void Reset();
+
+	private:
+		AsyncReadback( const AsyncReadback& );
+		const AsyncReadback& operator=( const AsyncReadback& );
+
+		VertexBuffer buffer;
+		Fence fence;
+		size_t size, capacity;
+		bool pending;
+
+		void Reserve( size_t bytes );
+		void ReadPixels( const Framebuffer& framebuffer, uint x, uint y, uint width, uint height, GLenum format, GLenum type );
+		void Submit();
+	};
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_COMMANDLIST_HPP
+#define OOGL_COMMANDLIST_HPP
+
+#include <GL/Platform.hpp>
+#include <GL/GL/Context.hpp>
+#include <GL/Math/Vec2.hpp>
+#include <GL/Math/Vec3.hpp>
+#include <GL/Math/Vec4.hpp>
+#include <GL/Math/Mat3.hpp>
+#include <GL/Math/Mat4.hpp>
+#include <memory>
+#include <vector>
+
+namespace GL
+{
+	class CommandArena;
+
+	/*
+		Recorded command stream
+
+		Records binds, uniform writes and draws without making any OpenGL
+		calls, so any thread can build one. Context::Execute() replays it on
+		the thread that owns the context. Commands are packed into chunks
+		taken from the recording thread's arena; Reset() hands them back, so
+		a list that is recorded every frame stops allocating after the first.
+
+		Only object names are recorded, the wrappers have to outlive the
+		replay. Uniform writes apply to the program last used in the list.
+		A list must only be recorded by one thread at a time.
+	*/
+	class CommandList
+	{
+	public:
+		CommandList();
+		~CommandList();
+
+		void UseProgram( const Program& program );
+		void BindTexture( const Texture& texture, uchar unit );
+		void BindUniformBuffer( const VertexBuffer& buffer, uint index );
+		void BindFramebuffer( const Framebuffer& framebuffer );
+		void BindFramebuffer();
+
+		void Enable( Capability::capability_t capability );
+		void Disable( Capability::capability_t capability );
+		void DepthMask( bool writeEnabled );
+		void SetPipelineState( const PipelineState& state );
+
+		void ClearColor( const Color& col );
+		void Clear( Buffer::buffer_t buffers = Buffer::Color | Buffer::Depth );
+
+		void SetUniform( const Uniform& uniform, int value );
+		void SetUniform( const Uniform& uniform, float value );
+		void SetUniform( const Uniform& uniform, const Vec2& value );
+		void SetUniform( const Uniform& uniform, const Vec3& value );
+		void SetUniform( const Uniform& uniform, const Vec4& value );
+		void SetUniform( const Uniform& uniform, const Mat3& value );
+		void SetUniform( const Uniform& uniform, const Mat4& value );
+
+		void DrawArrays( const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices );
+		void DrawElements( const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type );
+		void DrawArraysInstanced( const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices, uint instances );
+		void DrawElementsInstanced( const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type, uint instances );
+		void MultiDrawArraysIndirect( const VertexArray& vao, const DrawIndirectBuffer& commands, Primitive::primitive_t mode, uint count, intptr_t offset = 0, uint stride = 0 );
+		void MultiDrawElementsIndirect( const VertexArray& vao, const DrawIndirectBuffer& commands, Primitive::primitive_t mode, uint type, uint count, intptr_t offset = 0, uint stride = 0 );
+
+		void Reset();
+
+		uint GetCommandCount() const { return commandCount; }
+
+	private:
+		friend class Context;
+
+		CommandList( const CommandList& );
+		const CommandList& operator=( const CommandList& );
+
+		std::shared_ptr<CommandArena> arena;
+		std::vector<uchar*> chunks;
+		size_t used;
+		uint commandCount;
+
+		void* Allocate( uint type, size_t size );
+		void Replay( Context& context ) const;
+	};
+}
+
+#endif
@@ -0,0 +1,92 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_DRAWINDIRECTBUFFER_HPP
+#define OOGL_DRAWINDIRECTBUFFER_HPP
+
+#include <GL/GL/VertexBuffer.hpp>
+
+namespace GL
+{
+	/*
+		Indirect draw command layouts, as read by the GL
+	*/
+	struct DrawArraysIndirectCommand
+	{
+		uint count;
+		uint instanceCount;
+		uint first;
+		uint baseInstance;
+	};
+
+	struct DrawElementsIndirectCommand
+	{
+		uint count;
+		uint instanceCount;
+		uint firstIndex;
+		int baseVertex;
+		uint baseInstance;
+	};
+
+	/*
+		Draw command buffer
+
+		Holds the commands for Context::MultiDrawArraysIndirect and
+		MultiDrawElementsIndirect. Being a buffer like any other, it can be
+		written by the CPU through MapElements(), captured into by transform
+		feedback (VertexArray::BindTransformFeedback) or written by a compute
+		shader after BindStorage().
+
+		The capacity is counted in commands of the size the buffer was last
+		reserved for, so array and element commands are reserved separately
+		and sized buffers are made through ForArrays() or ForElements().
+	*/
+	class DrawIndirectBuffer : public VertexBuffer
+	{
+	public:
+		DrawIndirectBuffer();
+
+		static DrawIndirectBuffer ForArrays( uint commands, BufferUsage::buffer_usage_t usage = BufferUsage::DynamicDraw );
+		static DrawIndirectBuffer ForElements( uint commands, BufferUsage::buffer_usage_t usage = BufferUsage::DynamicDraw );
+
+		void ReserveArrays( uint commands, BufferUsage::buffer_usage_t usage = BufferUsage::DynamicDraw );
+		void ReserveElements( uint commands, BufferUsage::buffer_usage_t usage = BufferUsage::DynamicDraw );
+
+		// Maps the whole buffer for writing, discarding the previous commands
+		DrawArraysIndirectCommand* MapArrays();
+		DrawElementsIndirectCommand* MapElements();
+
+		void BindStorage( uint index );
+
+		uint GetCapacity() const { return capacity; }
+		size_t GetCommandSize() const { return commandSize; }
+
+	private:
+		uint capacity;
+		size_t commandSize;
+
+		void Reserve( uint commands, size_t commandSize, BufferUsage::buffer_usage_t usage );
+	};
+}
+
+#endif
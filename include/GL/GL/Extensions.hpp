@@ -78,6 +78,10 @@
 
 #define GL_MAJOR_VERSION 0x821B
 #define GL_MINOR_VERSION 0x821C
+#define GL_NUM_EXTENSIONS 0x821D
+
+typedef const GLubyte* ( APIENTRYP GLGETSTRINGI ) ( GLenum name, GLuint index );
+extern GLGETSTRINGI glGetStringi;
 
 /*
 	Shaders
@@ -210,6 +214,23 @@ extern GLUNIFORMMATRIX4X3FV glUniformMatrix4x3fv;
 
 #define GL_ARRAY_BUFFER 0x8892
 #define GL_ELEMENT_ARRAY_BUFFER 0x8893
+#define GL_SHADER_STORAGE_BUFFER 0x90D2
+#define GL_PIXEL_PACK_BUFFER 0x88EB
+#define GL_COPY_READ_BUFFER 0x8F36
+#define GL_COPY_WRITE_BUFFER 0x8F37
+
+#define GL_BUFFER_SIZE 0x8764
+
+#define GL_MAP_READ_BIT 0x0001
+#define GL_MAP_WRITE_BIT 0x0002
+#define GL_MAP_INVALIDATE_RANGE_BIT 0x0004
+#define GL_MAP_INVALIDATE_BUFFER_BIT 0x0008
+#define GL_MAP_FLUSH_EXPLICIT_BIT 0x0010
+#define GL_MAP_UNSYNCHRONIZED_BIT 0x0020
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_CLIENT_STORAGE_BIT 0x0200
 
 typedef void ( APIENTRYP GLGENBUFFERS ) ( GLsizei n, GLuint* buffers );
 extern GLGENBUFFERS glGenBuffers;
@@ -223,6 +244,18 @@ typedef void ( APIENTRYP GLBUFFERSUBDATA ) ( GLenum target, GLintptr offset, GLs
 extern GLBUFFERSUBDATA glBufferSubData;
 typedef void ( APIENTRYP GLGETBUFFERSUBDATA ) ( GLenum target, GLintptr offset, GLsizeiptr size, GLvoid* data );
 extern GLGETBUFFERSUBDATA glGetBufferSubData;
+typedef void ( APIENTRYP GLGETBUFFERPARAMETERIV ) ( GLenum target, GLenum pname, GLint* params );
+extern GLGETBUFFERPARAMETERIV glGetBufferParameteriv;
+typedef void* ( APIENTRYP GLMAPBUFFERRANGE ) ( GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access );
+extern GLMAPBUFFERRANGE glMapBufferRange;
+typedef GLboolean ( APIENTRYP GLUNMAPBUFFER ) ( GLenum target );
+extern GLUNMAPBUFFER glUnmapBuffer;
+typedef void ( APIENTRYP GLFLUSHMAPPEDBUFFERRANGE ) ( GLenum target, GLintptr offset, GLsizeiptr length );
+extern GLFLUSHMAPPEDBUFFERRANGE glFlushMappedBufferRange;
+typedef void ( APIENTRYP GLCOPYBUFFERSUBDATA ) ( GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size );
+extern GLCOPYBUFFERSUBDATA glCopyBufferSubData;
+typedef void ( APIENTRYP GLBUFFERSTORAGE ) ( GLenum target, GLsizeiptr size, const GLvoid* data, GLbitfield flags );
+extern GLBUFFERSTORAGE glBufferStorage;
 
 /*
 	VAOs
@@ -239,6 +272,17 @@ typedef void ( APIENTRYP GLENABLEVERTEXATTRIBARRAY ) ( GLuint index );
 extern GLENABLEVERTEXATTRIBARRAY glEnableVertexAttribArray;
 typedef void ( APIENTRYP GLVERTEXATTRIBPOINTER ) ( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid* pointer );
 extern GLVERTEXATTRIBPOINTER glVertexAttribPointer;
+typedef void ( APIENTRYP GLVERTEXATTRIBDIVISOR ) ( GLuint index, GLuint divisor );
+extern GLVERTEXATTRIBDIVISOR glVertexAttribDivisor;
+
+typedef void ( APIENTRYP GLDRAWARRAYSINSTANCED ) ( GLenum mode, GLint first, GLsizei count, GLsizei instancecount );
+extern GLDRAWARRAYSINSTANCED glDrawArraysInstanced;
+typedef void ( APIENTRYP GLDRAWELEMENTSINSTANCED ) ( GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instancecount );
+extern GLDRAWELEMENTSINSTANCED glDrawElementsInstanced;
+typedef void ( APIENTRYP GLDRAWELEMENTSBASEVERTEX ) ( GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLint basevertex );
+extern GLDRAWELEMENTSBASEVERTEX glDrawElementsBaseVertex;
+typedef void ( APIENTRYP GLDRAWELEMENTSINSTANCEDBASEVERTEX ) ( GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instancecount, GLint basevertex );
+extern GLDRAWELEMENTSINSTANCEDBASEVERTEX glDrawElementsInstancedBaseVertex;
 
 /*
 	Textures
@@ -291,6 +335,21 @@ extern GLGENERATEMIPMAP glGenerateMipmap;
 	extern GLACTIVETEXTURE glActiveTexture;
 #endif
 
+/*
+	Blending
+*/
+
+#ifndef GL_ARB_imaging
+	#define GL_FUNC_ADD 0x8006
+	#define GL_MIN 0x8007
+	#define GL_MAX 0x8008
+	#define GL_FUNC_SUBTRACT 0x800A
+	#define GL_FUNC_REVERSE_SUBTRACT 0x800B
+
+	typedef void ( APIENTRYP GLBLENDEQUATION ) ( GLenum mode );
+	extern GLBLENDEQUATION glBlendEquation;
+#endif
+
 /*
 	Data types
 */
@@ -307,6 +366,7 @@ extern GLGENERATEMIPMAP glGenerateMipmap;
 #define GL_UNSIGNED_SHORT_1_5_5_5_REV 0x8366
 #define GL_UNSIGNED_INT_8_8_8_8_REV 0x8367
 #define GL_UNSIGNED_INT_2_10_10_10_REV 0x8368
+#define GL_HALF_FLOAT 0x140B
 
 #define GL_COMPRESSED_RED 0x8225
 #define GL_COMPRESSED_RG 0x8226
@@ -385,7 +445,9 @@ extern GLGENERATEMIPMAP glGenerateMipmap;
 	Frame buffers
 */
 
+#define GL_READ_FRAMEBUFFER 0x8CA8
 #define GL_DRAW_FRAMEBUFFER 0x8CA9
+#define GL_READ_FRAMEBUFFER_BINDING 0x8CAA
 
 #define GL_COLOR_ATTACHMENT0 0x8CE0
 #define GL_COLOR_ATTACHMENT1 0x8CE1
@@ -460,6 +522,7 @@ extern GLBINDRENDERBUFFER glBindRenderbuffer;
 #define GL_RASTERIZER_DISCARD 0x8C89
 
 #define GL_TRANSFORM_FEEDBACK_BUFFER 0x8C8E
+#define GL_UNIFORM_BUFFER 0x8A11
 
 typedef void ( APIENTRYP GLTRANSFORMFEEDBACKVARYINGS ) ( GLuint program, GLsizei count, const char** varyings, GLenum bufferMode );
 extern GLTRANSFORMFEEDBACKVARYINGS glTransformFeedbackVaryings;
@@ -470,6 +533,90 @@ extern GLBEGINTRANSFORMFEEDBACK glBeginTransformFeedback;
 typedef void ( APIENTRYP GLENDTRANSFORMFEEDBACK ) ();
 extern GLENDTRANSFORMFEEDBACK glEndTransformFeedback;
 
+/*
+	Sync objects
+*/
+
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_ALREADY_SIGNALED 0x911A
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_CONDITION_SATISFIED 0x911C
+#define GL_WAIT_FAILED 0x911D
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
+
+#ifndef GL_VERSION_3_2
+	typedef struct __GLsync* GLsync;
+	typedef unsigned long long GLuint64;
+#endif
+
+typedef GLsync ( APIENTRYP GLFENCESYNC ) ( GLenum condition, GLbitfield flags );
+extern GLFENCESYNC glFenceSync;
+typedef void ( APIENTRYP GLDELETESYNC ) ( GLsync sync );
+extern GLDELETESYNC glDeleteSync;
+typedef GLenum ( APIENTRYP GLCLIENTWAITSYNC ) ( GLsync sync, GLbitfield flags, GLuint64 timeout );
+extern GLCLIENTWAITSYNC glClientWaitSync;
+typedef void ( APIENTRYP GLWAITSYNC ) ( GLsync sync, GLbitfield flags, GLuint64 timeout );
+extern GLWAITSYNC glWaitSync;
+
+/*
+	Queries
+*/
+
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#define GL_TIME_ELAPSED 0x88BF
+#define GL_TIMESTAMP 0x8E28
+
+typedef void ( APIENTRYP GLGENQUERIES ) ( GLsizei n, GLuint* ids );
+extern GLGENQUERIES glGenQueries;
+typedef void ( APIENTRYP GLDELETEQUERIES ) ( GLsizei n, const GLuint* ids );
+extern GLDELETEQUERIES glDeleteQueries;
+typedef void ( APIENTRYP GLBEGINQUERY ) ( GLenum target, GLuint id );
+extern GLBEGINQUERY glBeginQuery;
+typedef void ( APIENTRYP GLENDQUERY ) ( GLenum target );
+extern GLENDQUERY glEndQuery;
+typedef void ( APIENTRYP GLQUERYCOUNTER ) ( GLuint id, GLenum target );
+extern GLQUERYCOUNTER glQueryCounter;
+typedef void ( APIENTRYP GLGETQUERYOBJECTIV ) ( GLuint id, GLenum pname, GLint* params );
+extern GLGETQUERYOBJECTIV glGetQueryObjectiv;
+typedef void ( APIENTRYP GLGETQUERYOBJECTUI64V ) ( GLuint id, GLenum pname, GLuint64* params );
+extern GLGETQUERYOBJECTUI64V glGetQueryObjectui64v;
+
+/*
+	Indirect drawing
+*/
+
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+
+typedef void ( APIENTRYP GLDRAWARRAYSINDIRECT ) ( GLenum mode, const GLvoid* indirect );
+extern GLDRAWARRAYSINDIRECT glDrawArraysIndirect;
+typedef void ( APIENTRYP GLDRAWELEMENTSINDIRECT ) ( GLenum mode, GLenum type, const GLvoid* indirect );
+extern GLDRAWELEMENTSINDIRECT glDrawElementsIndirect;
+typedef void ( APIENTRYP GLMULTIDRAWARRAYSINDIRECT ) ( GLenum mode, const GLvoid* indirect, GLsizei drawcount, GLsizei stride );
+extern GLMULTIDRAWARRAYSINDIRECT glMultiDrawArraysIndirect;
+typedef void ( APIENTRYP GLMULTIDRAWELEMENTSINDIRECT ) ( GLenum mode, GLenum type, const GLvoid* indirect, GLsizei drawcount, GLsizei stride );
+extern GLMULTIDRAWELEMENTSINDIRECT glMultiDrawElementsIndirect;
+
+/*
+	Direct state access
+*/
+
+typedef void ( APIENTRYP GLCREATETEXTURES ) ( GLenum target, GLsizei n, GLuint* textures );
+extern GLCREATETEXTURES glCreateTextures;
+typedef void ( APIENTRYP GLTEXTUREPARAMETERI ) ( GLuint texture, GLenum pname, GLint param );
+extern GLTEXTUREPARAMETERI glTextureParameteri;
+typedef void ( APIENTRYP GLTEXTUREPARAMETERFV ) ( GLuint texture, GLenum pname, const GLfloat* params );
+extern GLTEXTUREPARAMETERFV glTextureParameterfv;
+typedef void ( APIENTRYP GLGENERATETEXTUREMIPMAP ) ( GLuint texture );
+extern GLGENERATETEXTUREMIPMAP glGenerateTextureMipmap;
+typedef void ( APIENTRYP GLCREATEFRAMEBUFFERS ) ( GLsizei n, GLuint* framebuffers );
+extern GLCREATEFRAMEBUFFERS glCreateFramebuffers;
+typedef void ( APIENTRYP GLNAMEDFRAMEBUFFERTEXTURE ) ( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level );
+extern GLNAMEDFRAMEBUFFERTEXTURE glNamedFramebufferTexture;
+typedef GLenum ( APIENTRYP GLCHECKNAMEDFRAMEBUFFERSTATUS ) ( GLuint framebuffer, GLenum target );
+extern GLCHECKNAMEDFRAMEBUFFERSTATUS glCheckNamedFramebufferStatus;
+
 /*
 	Extension loader
 */
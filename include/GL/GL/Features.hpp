@@ -0,0 +1,57 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_FEATURES_HPP
+#define OOGL_FEATURES_HPP
+
+#include <GL/Platform.hpp>
+
+namespace GL
+{
+	/*
+		Optional OpenGL features with a faster code path
+	*/
+	namespace Feature
+	{
+		enum feature_t
+		{
+			DirectStateAccess,
+			MultiDrawIndirect,
+			TimerQuery,
+			BufferStorage,
+			DrawIndirect
+		};
+	}
+
+	/*
+		Feature detection
+
+		Support is detected the first time a feature is asked for, so a
+		context has to be current by then. DisableFeature() forces the
+		fallback path, e.g. to compare both.
+	*/
+	bool HasFeature( Feature::feature_t feature );
+	void DisableFeature( Feature::feature_t feature );
+}
+
+#endif
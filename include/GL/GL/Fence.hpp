@@ -0,0 +1,108 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_FENCE_HPP
+#define OOGL_FENCE_HPP
+
+#include <GL/Platform.hpp>
+#include <cstdint>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
+{
+	/*
+		Sync object
+
+		Insert() marks the current point in the command stream; the fence is
+		signaled once the GPU has finished everything submitted before it.
+		That tells when a buffer the GPU was reading from may be written
+		again. A fence that was never inserted counts as signaled. Fences
+		can't be copied, only moved.
+	*/
+	class Fence
+	{
+	public:
+		Fence();
+		Fence( Fence&& other ) noexcept;
+		~Fence();
+
+		const Fence& operator=( Fence&& other ) noexcept;
+
+		void Insert();
+		void Reset();
+
+		bool IsSet() const { return sync != 0; }
+		bool IsSignaled() const;
+
+		// Blocks until the fence is signaled or the timeout runs out, returns whether it was signaled
+		bool Wait( uint64_t timeoutNanoseconds = ~0ull ) const;
+
+		// Makes the GPU rather than the CPU wait for the fence before running later commands
+		void WaitOnServer() const;
+
+	private:
+		Fence( const Fence& );
+		const Fence& operator=( const Fence& );
+
+		GLsync sync;
+	};
+
+	/*
+		Frames in flight limit
+
+		EndFrame() fences the frame that was just submitted and then blocks
+		until no more than the set number of frames are still queued up on
+		the GPU. That keeps the CPU from running ahead, which keeps input
+		latency predictable, and means a buffer written that many frames ago
+		is safe to write again. Pacing is off with a limit of 0. A copy starts
+		out with no frames in flight.
+	*/
+	class FramePacer
+	{
+	public:
+		static const uint MaxFramesInFlight = 8;
+
+		FramePacer( uint framesInFlight = 0 );
+		FramePacer( const FramePacer& other );
+
+		const FramePacer& operator=( const FramePacer& other );
+
+		void SetFramesInFlight( uint frames );
+		uint GetFramesInFlight() const { return framesInFlight; }
+
+		void EndFrame();
+		void Reset();
+
+	private:
+		static const uint Slots = MaxFramesInFlight + 1;
+
+		Fence fences[Slots];
+		uint first, count;
+		uint framesInFlight;
+	};
+}
+
+#endif
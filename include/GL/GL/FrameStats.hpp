@@ -0,0 +1,90 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_FRAMESTATS_HPP
+#define OOGL_FRAMESTATS_HPP
+
+#include <GL/Platform.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace GL
+{
+	/*
+		Frame time statistics
+
+		Keeps the times of the last frames in a ring and counts hitches:
+		frames that took more than HitchFactor times the running average.
+		Percentiles are worked out over the history when asked for. Frames
+		are fed by Window::Present(), so query from the render thread.
+
+		Time the CPU spent blocked on frame pacing is added with AddWait()
+		and kept with the frame that ends next.
+	*/
+	class FrameStats
+	{
+	public:
+		struct Summary
+		{
+			uint frames;
+			double average;
+			double p50, p95, p99;
+			double max;
+			uint hitches;
+			double waitAverage, waitMax;
+		};
+
+		FrameStats( uint history = 600 );
+
+		void Tick( int64_t nanoseconds );
+		void AddFrame( int64_t nanoseconds );
+		void AddWait( int64_t nanoseconds );
+
+		double GetFrameTime( uint framesAgo = 0 ) const;
+		double GetWaitTime( uint framesAgo = 0 ) const;
+		double GetPercentile( double percentile ) const;
+		Summary GetSummary() const;
+
+		uint GetFrameCount() const { return count; }
+		uint GetHitchCount() const { return hitches; }
+
+		void SetHitchFactor( double factor ) { hitchFactor = factor; }
+		void Reset();
+
+	private:
+		std::vector<int64_t> frames;
+		std::vector<int64_t> waits;
+		int64_t pendingWait;
+		mutable std::vector<int64_t> sorted;
+		uint next, count;
+
+		int64_t lastTick;
+		double average;
+		double hitchFactor;
+		uint hitches;
+
+		double Percentile( double percentile ) const;
+	};
+}
+
+#endif
@@ -43,24 +43,27 @@ namespace GL
 	/*
 		Frame buffer
 	*/
-	class Framebuffer
+	class Framebuffer : public GLObject<FramebufferTraits>
 	{
 	public:
-		Framebuffer( const Framebuffer& other );
 		Framebuffer( uint width, uint height, uchar color = 32, uchar depth = 24 );
-		~Framebuffer();
-
-		operator GLuint() const;
-		const Framebuffer& operator=( const Framebuffer& other );
 
 		const Texture& GetTexture();
 		const Texture& GetDepthTexture();
 
+		uint GetWidth() const { return width; }
+		uint GetHeight() const { return height; }
+		InternalFormat::internal_format_t GetColorFormat() const { return colorFormat; }
+		InternalFormat::internal_format_t GetDepthFormat() const { return depthFormat; }
+
 	private:
-		static GC gc;
-		GLuint obj;
 		Texture texColor;
 		Texture texDepth;
+
+		// Kept so binding never has to query the attachments
+		uint width, height;
+		InternalFormat::internal_format_t colorFormat;
+		InternalFormat::internal_format_t depthFormat;
 	};
 }
 
@@ -25,64 +25,144 @@
 #define OOGL_GC_HPP
 
 #include <GL/Platform.hpp>
-#include <functional>
-
-#if defined( OOGL_PLATFORM_WINDOWS) || defined(OOGL_PLATFORM_UNIX)
- #include <map>
-#elif defined(OOGL_PLATFORM_SDL)
- #include <unordered_map>
-#endif
+#include <GL/GL/Memory.hpp>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <cstdint>
 
 using namespace std;
 namespace GL
 {
-	/*
-		OpenGL object creation/destruction function prototypes
-	*/
-#if defined( OOGL_PLATFORM_WINDOWS) 
-	typedef void(__stdcall * createFunc) (GLsizei, GLuint*);
-	typedef void(__stdcall * deleteFunc) (GLsizei, const GLuint*);
-	typedef void(__stdcall * deleteFunc2) (GLuint);
-#elif defined( OOGL_PLATFORM_LINUX )
-	typedef void(*createFunc) (GLsizei, GLuint*);
-	typedef void(*deleteFunc) (GLsizei, const GLuint*);
-	typedef void(*deleteFunc2) (GLuint);
-#endif
-
 	/*
 		OpenGL object garbage collector
+
+		Reference counts are kept in a dense slot table instead of a map keyed
+		on the object name. Every wrapper holds a handle that packs the index of
+		its slot together with the generation of that slot, so lookups are a
+		single array access and handles to released slots can be detected.
+
+		Release() drops a reference and reports the name once the last one is
+		gone; deleting it is up to the caller (see GLObject).
+
+		A GC constructed with generate/delete entry points also pools names:
+		they are generated batchSize at a time and handed out from a free list.
+		Retired names are not deleted right away but queued for the current
+		frame. EndFrame(), called by Window::Present, deletes the queues of
+		frames the GPU has finished with in one call per collector. With frame
+		fencing enabled that is decided by a fence per frame, otherwise the
+		queues are deleted as soon as the frame ends. Flush() deletes everything
+		queued immediately.
+
+		Every collector has its own lock, so wrappers can be created, copied
+		and dropped from loader threads that have a shared context current
+		(see Context::CreateSharedContext). GL calls for pooled names happen
+		on whichever thread refills the pool; deletion always happens on the
+		thread that ends the frame.
+
+		Container objects (vertex arrays, framebuffers) belong to the context
+		they were created on, while deletion runs on the main context. Their
+		collectors are constructed perContext and assert that they are never
+		created or retired while a shared context is current.
+
+		Each slot also carries the estimated footprint of the object's storage,
+		which is reported to Memory under the collector's category.
 	*/
 	class GC
 	{
-#if defined(OOGL_PLATFORM_WINDOWS) || defined( OOGL_PLATFORM_LINUX ) 
 	public:
+		typedef uint32_t Handle;
+		static const Handle Null = 0;
 
-		void Create(GLuint& obj, createFunc c, deleteFunc d);
-		int  Create(const GLuint& obj, deleteFunc2 d2);
-		void Copy(const GLuint& from, GLuint& to, bool destructive = false);
-		void Destroy(GLuint& obj);
+		typedef void (*GenerateFunc)(GLsizei n, ID* ids);
+		typedef void (*DeleteFunc)(GLsizei n, const ID* ids);
 
-	private:
-		std::map<GLuint, uint> refs;
-		deleteFunc d;
-		deleteFunc2 d2;
+		struct Stats
+		{
+			uint namesGenerated;
+			uint generateCalls;
+			uint namesDeleted;
+			uint deleteCalls;
 
-#elif defined(OOGL_PLATFORM_SDL)
-	private:
+			uint SavedCalls() const { return (namesGenerated - generateCalls) + (namesDeleted - deleteCalls); }
+		};
 
-		unordered_map<ID, uint16_t> refs;
+		GC(GenerateFunc generateFunc = nullptr, DeleteFunc deleteFunc = nullptr, uint batchSize = 1, MemoryCategory::memory_category_t category = MemoryCategory::Other, bool perContext = false);
+		~GC();
 
-	public:
+		ID   Create(Handle& handle);
+		ID   Create(Handle& handle, ID id);
+		void Copy(Handle& dst, const Handle& src);
+		bool Release(Handle& handle, ID& id);
+
+		void Retire(ID id);
+		void Flush();
+		uint GetRetiredCount() const;
+
+		static void EndFrame();
+		static void FlushAll();
+		static void SetFrameFencing(bool enabled);
+		static bool GetFrameFencing();
+		static uint GetDeleteEpoch();
 
-		ID   Create(ID id);
-		ID   Create(function<ID()>);
-		ID   Create(function<void(GLsizei, GL::ID*)> generatorFunc);
+		// Set by Context::Activate for the calling thread
+		static void SetSharedContextCurrent(bool shared);
 
-		void Copy(ID& dst, const ID& src);
-		void Destroy(ID& obj, std::function<void(GLsizei, const ID*)> deleterFunc);
-		void Destroy(ID& obj, std::function<void(GLuint)> deleterFunc);
+		void SetBatchSize(uint size);
+		uint GetBatchSize() const;
+		Stats GetStats() const;
 
-#endif
+		void   SetFootprint(Handle handle, size_t bytes, bool mipChain = false);
+		void   SetMipChain(Handle handle, bool mipChain);
+		size_t GetFootprint(Handle handle) const;
+
+		bool IsValid(Handle handle) const;
+		ID   GetID(Handle handle) const;
+		uint GetRefCount(Handle handle) const;
+		uint GetObjectCount() const;
+
+	private:
+		GC(const GC&);
+		const GC& operator=(const GC&);
+
+		static const uint IndexBits = 20;
+		static const uint IndexMask = (1u << IndexBits) - 1;
+		static const uint GenerationMask = (1u << (32 - IndexBits)) - 1;
+
+		std::vector<uint> refs;
+		std::vector<ID> ids;
+		std::vector<uint16_t> generations;
+		std::vector<uint> freeSlots;
+		std::vector<size_t> footprints;
+		std::vector<uint8_t> mipChains;
+
+		GenerateFunc generateFunc;
+		DeleteFunc deleteFunc;
+		uint batchSize;
+		MemoryCategory::memory_category_t category;
+		bool perContext;
+		std::vector<ID> freeNames;
+		std::vector<ID> retiredNames;
+		Stats stats;
+		mutable std::mutex mutex;
+
+		struct RetiredFrame
+		{
+			uint64_t frame;
+			std::vector<ID> names;
+		};
+		std::deque<RetiredFrame> retiredFrames;
+
+		Handle Allocate(ID id);
+		bool Valid(Handle handle) const;
+		size_t Footprint(uint index) const;
+		// Returns the change in footprint; the caller reports it to Memory once
+		// the lock is released, since the budget callback may create or
+		// release objects itself
+		ptrdiff_t Account(uint index, size_t bytes, bool mipChain);
+		void Delete(std::vector<ID>& names);
+		bool RetireFrame(uint64_t frame);
+		void DeleteFrames(uint64_t completed);
 	};
 };
 
@@ -0,0 +1,206 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_GLOBJECT_HPP
+#define OOGL_GLOBJECT_HPP
+
+#include <GL/Platform.hpp>
+#include <GL/GL/GC.hpp>
+#include <GL/GL/Features.hpp>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
+{
+	/*
+		OpenGL object creation/destruction entry points
+
+		BatchSize is how many names the GC generates per driver call. Programs
+		and shaders can't be created in bulk, so they keep going one at a time.
+		Vertex arrays and framebuffers aren't pooled either: they aren't shared
+		between contexts, so a spare name generated on a worker context would
+		not be an object on the one it was later handed out on. PerContext
+		marks them so the GC can catch them being created or released while a
+		shared context is current, their deletion would run on the main one.
+		Category is where the footprint of the object's storage is counted.
+		Textures and framebuffers are created rather than just named when DSA
+		is available, since the named functions only accept created objects.
+	*/
+	struct BufferTraits
+	{
+		static const MemoryCategory::memory_category_t Category = MemoryCategory::Buffer;
+		static const uint BatchSize = 256;
+		static const bool PerContext = false;
+		static void Generate( GLsizei n, ID* ids ) { glGenBuffers( n, ids ); }
+		static void Delete( GLsizei n, const ID* ids ) { glDeleteBuffers( n, ids ); }
+	};
+
+	struct VertexArrayTraits
+	{
+		static const MemoryCategory::memory_category_t Category = MemoryCategory::Other;
+		static const uint BatchSize = 1;
+		static const bool PerContext = true;
+		static void Generate( GLsizei n, ID* ids ) { glGenVertexArrays( n, ids ); }
+		static void Delete( GLsizei n, const ID* ids ) { glDeleteVertexArrays( n, ids ); }
+	};
+
+	struct TextureTraits
+	{
+		static const MemoryCategory::memory_category_t Category = MemoryCategory::Texture;
+		static const uint BatchSize = 256;
+		static const bool PerContext = false;
+		static void Generate( GLsizei n, ID* ids )
+		{
+			if ( HasFeature( Feature::DirectStateAccess ) )
+				glCreateTextures( GL_TEXTURE_2D, n, ids );
+			else
+				glGenTextures( n, ids );
+		}
+		static void Delete( GLsizei n, const ID* ids ) { glDeleteTextures( n, ids ); }
+	};
+
+	struct FramebufferTraits
+	{
+		static const MemoryCategory::memory_category_t Category = MemoryCategory::Other;
+		static const uint BatchSize = 1;
+		static const bool PerContext = true;
+		static void Generate( GLsizei n, ID* ids )
+		{
+			if ( HasFeature( Feature::DirectStateAccess ) )
+				glCreateFramebuffers( n, ids );
+			else
+				glGenFramebuffers( n, ids );
+		}
+		static void Delete( GLsizei n, const ID* ids ) { glDeleteFramebuffers( n, ids ); }
+	};
+
+	struct RenderbufferTraits
+	{
+		static const MemoryCategory::memory_category_t Category = MemoryCategory::Renderbuffer;
+		static const uint BatchSize = 16;
+		static const bool PerContext = false;
+		static void Generate( GLsizei n, ID* ids ) { glGenRenderbuffers( n, ids ); }
+		static void Delete( GLsizei n, const ID* ids ) { glDeleteRenderbuffers( n, ids ); }
+	};
+
+	struct ProgramTraits
+	{
+		static const MemoryCategory::memory_category_t Category = MemoryCategory::Other;
+		static const uint BatchSize = 1;
+		static const bool PerContext = false;
+		static void Generate( GLsizei n, ID* ids ) { for ( GLsizei i = 0; i < n; i++ ) ids[i] = glCreateProgram(); }
+		static void Delete( GLsizei n, const ID* ids ) { for ( GLsizei i = 0; i < n; i++ ) glDeleteProgram( ids[i] ); }
+	};
+
+	struct ShaderTraits
+	{
+		static const MemoryCategory::memory_category_t Category = MemoryCategory::Other;
+		static const uint BatchSize = 1;
+		static const bool PerContext = false;
+		static constexpr GC::GenerateFunc Generate = nullptr;
+		static void Delete( GLsizei n, const ID* ids ) { for ( GLsizei i = 0; i < n; i++ ) glDeleteShader( ids[i] ); }
+	};
+
+	/*
+		Reference counted OpenGL object
+
+		The entry points come from the traits at compile time, so a wrapper is
+		just its name and the handle of its slot in the per-type GC. Moving a
+		wrapper hands over its reference without touching the GC. Names whose
+		last reference is dropped are retired to the GC and deleted in a batch
+		once the frame has ended (see GC::EndFrame).
+	*/
+	template <typename Traits>
+	class GLObject
+	{
+	public:
+		operator GLuint() const { return m_ID; }
+
+		size_t GetFootprint() const { return gc.GetFootprint( m_Handle ); }
+
+		static GC& GetGC() { return gc; }
+
+	protected:
+		GLObject() { m_ID = gc.Create( m_Handle ); }
+		explicit GLObject( ID id ) { m_ID = gc.Create( m_Handle, id ); }
+
+		GLObject( const GLObject& other )
+		{
+			m_ID = other.m_ID;
+			gc.Copy( m_Handle, other.m_Handle );
+		}
+
+		GLObject( GLObject&& other ) noexcept
+		{
+			m_ID = other.m_ID;
+			m_Handle = other.m_Handle;
+			other.m_ID = 0;
+			other.m_Handle = GC::Null;
+		}
+
+		~GLObject() { Destroy(); }
+
+		const GLObject& operator=( const GLObject& other )
+		{
+			if ( m_Handle != other.m_Handle ) {
+				Destroy();
+				gc.Copy( m_Handle, other.m_Handle );
+				m_ID = other.m_ID;
+			}
+			return *this;
+		}
+
+		const GLObject& operator=( GLObject&& other ) noexcept
+		{
+			if ( this != &other ) {
+				Destroy();
+				m_ID = other.m_ID;
+				m_Handle = other.m_Handle;
+				other.m_ID = 0;
+				other.m_Handle = GC::Null;
+			}
+			return *this;
+		}
+
+		void SetFootprint( size_t bytes, bool mipChain = false ) { gc.SetFootprint( m_Handle, bytes, mipChain ); }
+
+		void Destroy()
+		{
+			ID id;
+			if ( gc.Release( m_Handle, id ) ) gc.Retire( id );
+			m_ID = 0;
+		}
+
+		GLuint m_ID{ 0 };
+		GC::Handle m_Handle{ GC::Null };
+
+		static GC gc;
+	};
+
+	template <typename Traits>
+	GC GLObject<Traits>::gc( Traits::Generate, Traits::Delete, Traits::BatchSize, Traits::Category, Traits::PerContext );
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_GEOMETRYARENA_HPP
+#define OOGL_GEOMETRYARENA_HPP
+
+#include <GL/GL/VertexBuffer.hpp>
+#include <GL/GL/DrawIndirectBuffer.hpp>
+#include <functional>
+#include <vector>
+#include <map>
+#include <assert.h>
+
+namespace GL
+{
+	/*
+		Geometry arena
+
+		One vertex buffer and one index buffer shared by many meshes, so a
+		single vertex array can draw all of them. Allocate() copies a mesh
+		into the first free ranges that fit and returns a handle, and Get()
+		tells where the mesh ended up. Indices are 32-bit and relative to the
+		mesh's own vertices. Draw a mesh with Context::DrawElementsBaseVertex
+		at firstIndex * sizeof( uint ), or many at once with an indirect
+		buffer filled through GetDrawCommand(). A mesh without indices gets
+		sequential ones, so every allocation is drawn the same way.
+
+		The buffers don't grow. Allocate() defragments when the free space
+		is there but split up, and returns 0 when it really is full.
+		Defragment() moves meshes on the GPU and keeps the buffers, so vertex
+		arrays stay valid, but ranges and draw commands fetched before then
+		are out of date.
+	*/
+	class GeometryArena
+	{
+	public:
+		typedef uint Handle;
+
+		struct Range
+		{
+			int baseVertex;
+			uint firstIndex;
+			uint count;
+			uint vertexCount;
+		};
+
+		GeometryArena( uint vertexSize, uint vertexCapacity, uint indexCapacity, BufferUsage::buffer_usage_t usage = BufferUsage::StaticDraw );
+
+		Handle Allocate( const void* vertices, uint vertexCount, const uint* indices = 0, uint indexCount = 0 );
+		Handle Allocate( const Mesh& mesh, std::function<void ( const Vertex& v, VertexDataBuffer& data )> f );
+		void Free( Handle handle );
+
+		const Range& Get( Handle handle ) const
+		{
+			assert( handle > 0 && handle <= ranges.size() && "invalid GeometryArena handle" );
+			return ranges[handle - 1];
+		}
+		DrawElementsIndirectCommand GetDrawCommand( Handle handle, uint instances = 1, uint baseInstance = 0 ) const;
+
+		void Defragment();
+
+		const VertexBuffer& GetVertexBuffer() const { return vertexBuffer; }
+		const VertexBuffer& GetIndexBuffer() const { return indexBuffer; }
+		uint GetVertexSize() const { return vertexSize; }
+
+		uint GetFreeVertices() const { return vertexSpace.GetFree(); }
+		uint GetFreeIndices() const { return indexSpace.GetFree(); }
+		uint GetMeshCount() const { return (uint)( ranges.size() - freeHandles.size() ); }
+
+	private:
+		// First fit free list, neighbouring free blocks are merged on release
+		class FreeList
+		{
+		public:
+			static const uint Full = ~0u;
+
+			FreeList( uint capacity );
+
+			uint Allocate( uint size );
+			void Release( uint offset, uint size );
+			void Reset( uint used );
+
+			uint GetFree() const { return free; }
+
+		private:
+			std::map<uint, uint> blocks;
+			uint capacity, free;
+		};
+
+		VertexBuffer vertexBuffer;
+		VertexBuffer indexBuffer;
+		uint vertexSize;
+
+		FreeList vertexSpace;
+		FreeList indexSpace;
+
+		std::vector<Range> ranges;
+		std::vector<Handle> freeHandles;
+
+		// Staging for moves onto a range that overlaps their source
+		VertexBuffer scratch;
+		size_t scratchSize;
+
+		bool Reserve( uint vertexCount, uint indexCount, Range& range );
+		void Move( const VertexBuffer& buffer, uint elementSize, uint from, uint to, uint count );
+	};
+}
+
+#endif
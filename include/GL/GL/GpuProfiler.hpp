@@ -0,0 +1,128 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_GPUPROFILER_HPP
+#define OOGL_GPUPROFILER_HPP
+
+#include <GL/Platform.hpp>
+#include <vector>
+
+namespace GL
+{
+	/*
+		GPU timer
+
+		Scopes are timed with a GL_TIMESTAMP query at each end, so they can
+		nest; the frame as a whole is one GL_TIME_ELAPSED query. Queries of a
+		frame are only read once every one of them reports its result as
+		available, which normally takes a frame or two, so results lag behind
+		by up to the number of buffered frames. If the GPU falls that far
+		behind, frames are skipped rather than waited for.
+
+		Scopes with the same name under the same parent are added up, so a
+		scope in a loop shows up once with its call count. Scope names must
+		outlive the profiler, string literals are the intended use.
+		Does nothing without GL 3.3 or ARB_timer_query.
+	*/
+	class GpuProfiler
+	{
+	public:
+		struct Result
+		{
+			const char* name;
+			uint depth;
+			int parent; // index into the results, -1 for top level scopes
+			uint calls;
+			double milliseconds;
+		};
+
+		class Scope
+		{
+		public:
+			Scope( GpuProfiler& profiler, const char* name ) : profiler( profiler ) { profiler.Begin( name ); }
+			~Scope() { profiler.End(); }
+
+		private:
+			GpuProfiler& profiler;
+
+			Scope( const Scope& );
+			const Scope& operator=( const Scope& );
+		};
+
+		GpuProfiler( uint bufferedFrames = 3 );
+		~GpuProfiler();
+
+		void BeginFrame();
+		void EndFrame();
+
+		void Begin( const char* name );
+		void End();
+
+		// Latest frame with all results in, in scope order with parents first
+		const std::vector<Result>& GetResults() const { return results; }
+		double GetFrameTime() const { return frameTime; }
+		uint GetResultFrame() const { return resultFrame; }
+		uint GetSkippedFrames() const { return skippedFrames; }
+
+	private:
+		struct Mark
+		{
+			const char* name;
+			uint depth;
+			int parent;
+			uint begin, end; // query indices
+		};
+
+		struct Frame
+		{
+			uint number;
+			bool recording, pending;
+			GLuint elapsedQuery;
+			std::vector<GLuint> queries;
+			uint usedQueries;
+			std::vector<Mark> marks;
+		};
+
+		std::vector<Frame> frames;
+		uint current;
+		uint frameNumber;
+		bool enabled;
+
+		std::vector<uint> open;
+
+		std::vector<Result> results;
+		std::vector<int> resultIndex;
+		double frameTime;
+		uint resultFrame;
+		uint skippedFrames;
+
+		uint Timestamp( Frame& frame );
+		bool Available( const Frame& frame ) const;
+		void Collect( Frame& frame );
+
+		GpuProfiler( const GpuProfiler& );
+		const GpuProfiler& operator=( const GpuProfiler& );
+	};
+}
+
+#endif
@@ -1,26 +1,13 @@
 #pragma once
 #include "assert.h"
-#include <functional>
-#include <GL/GL/GC.hpp>
+#include <GL/GL/GLObject.hpp>
 
-class IndexBuffer {
-
-public:
-	GLuint m_ID{ 0 };
-
-private:
-	static GL::GC gc;
-	std::function<void(GLsizei, GL::ID*)> m_GeneratorFunc{ glGenBuffers } ;
-	std::function<void(GLsizei, const GL::ID*)> m_DeleterFunc{ glDeleteBuffers } ;
+class IndexBuffer : public GL::GLObject<GL::BufferTraits> {
 
 public:
 
 	IndexBuffer();
 	IndexBuffer(const GLvoid* data, GLsizei length, GLenum usage);
-	IndexBuffer(const IndexBuffer& rhs) ;
-	const IndexBuffer& operator=(const IndexBuffer& rhs) ;
-	operator GLuint() const;
-	~IndexBuffer();
 
 	GL::ID id() const {
 		return m_ID;
@@ -29,6 +16,11 @@ public:
 	void Data(const GLvoid* data, GLsizeiptr lenght, GLenum usage);
 	void SubData(const GLvoid* data, GLsizeiptr offset, GLsizeiptr length);
 	void GetSubData(GLvoid* data, GLsizeiptr  offset, GLsizeiptr length);
+
+	GLvoid* Map(GLbitfield access);
+	GLvoid* MapRange(GLintptr offset, GLsizeiptr length, GLbitfield access);
+	void FlushMappedRange(GLintptr offset, GLsizeiptr length);
+	bool Unmap();
 	void Destroy();
 
-};
\ No newline at end of file
+};
@@ -0,0 +1,76 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_MEMORY_HPP
+#define OOGL_MEMORY_HPP
+
+#include <GL/Platform.hpp>
+#include <functional>
+#include <cstddef>
+
+namespace GL
+{
+	/*
+		Memory categories
+	*/
+	namespace MemoryCategory
+	{
+		enum memory_category_t
+		{
+			Buffer,
+			Texture,
+			Renderbuffer,
+			Other
+		};
+
+		const uint Count = Other + 1;
+	}
+
+	/*
+		GPU memory accounting
+
+		Wrappers report the estimated footprint of their storage to the GC,
+		which forwards the difference here and takes it off again when the
+		last reference goes away. Framebuffer attachments are counted with
+		the textures and render buffers they are made of.
+
+		The budget callback runs on the thread whose allocation pushed the
+		total over the budget, once per crossing.
+	*/
+	class Memory
+	{
+	public:
+		typedef std::function<void( size_t usage, size_t budget )> BudgetCallback;
+
+		static size_t GetUsage();
+		static size_t GetUsage( MemoryCategory::memory_category_t category );
+		static size_t GetPeakUsage();
+
+		static void SetBudget( size_t budget, const BudgetCallback& callback );
+		static size_t GetBudget();
+
+		static void Track( MemoryCategory::memory_category_t category, ptrdiff_t bytes );
+	};
+}
+
+#endif
@@ -0,0 +1,203 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_PIPELINESTATE_HPP
+#define OOGL_PIPELINESTATE_HPP
+
+#include <GL/Platform.hpp>
+#include <cstdint>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+// Xlib interference
+#ifdef OOGL_PLATFORM_LINUX
+#undef Always
+#endif
+
+namespace GL
+{
+	/*
+		Capabilities to enable/disable
+	*/
+	namespace Capability
+	{
+		enum capability_t
+		{
+			DepthTest = GL_DEPTH_TEST,
+			StencilTest = GL_STENCIL_TEST,
+			CullFace = GL_CULL_FACE,
+			RasterizerDiscard = GL_RASTERIZER_DISCARD,
+			Blend = GL_BLEND
+		};
+	}
+
+	/*
+		Depth and stencil test functions
+	*/
+	namespace TestFunction
+	{
+		enum test_function_t
+		{
+			Never = GL_NEVER,
+			Less = GL_LESS,
+			LessEqual = GL_LEQUAL,
+			Greater = GL_GREATER,
+			GreaterEqual = GL_GEQUAL,
+			Equal = GL_EQUAL,
+			NotEqual = GL_NOTEQUAL,
+			Always = GL_ALWAYS
+		};
+	}
+
+	/*
+		Stencil operation
+	*/
+	namespace StencilAction
+	{
+		enum stencil_action_t
+		{
+			Keep = GL_KEEP,
+			Zero = GL_ZERO,
+			Replace = GL_REPLACE,
+			Increase = GL_INCR,
+			IncreaseWrap = GL_INCR_WRAP,
+			Decrease = GL_DECR,
+			DecreaseWrap = GL_DECR_WRAP,
+			Invert = GL_INVERT
+		};
+	}
+
+	/*
+		Faces to cull
+	*/
+	namespace Face
+	{
+		enum face_t
+		{
+			Front = GL_FRONT,
+			Back = GL_BACK,
+			FrontAndBack = GL_FRONT_AND_BACK
+		};
+	}
+
+	/*
+		Blending factors
+	*/
+	namespace BlendFactor
+	{
+		enum blend_factor_t
+		{
+			Zero = GL_ZERO,
+			One = GL_ONE,
+			SourceColor = GL_SRC_COLOR,
+			OneMinusSourceColor = GL_ONE_MINUS_SRC_COLOR,
+			DestinationColor = GL_DST_COLOR,
+			OneMinusDestinationColor = GL_ONE_MINUS_DST_COLOR,
+			SourceAlpha = GL_SRC_ALPHA,
+			OneMinusSourceAlpha = GL_ONE_MINUS_SRC_ALPHA,
+			DestinationAlpha = GL_DST_ALPHA,
+			OneMinusDestinationAlpha = GL_ONE_MINUS_DST_ALPHA
+		};
+	}
+
+	/*
+		Blending equations
+	*/
+	namespace BlendEquation
+	{
+		enum blend_equation_t
+		{
+			Add = GL_FUNC_ADD,
+			Subtract = GL_FUNC_SUBTRACT,
+			ReverseSubtract = GL_FUNC_REVERSE_SUBTRACT,
+			Min = GL_MIN,
+			Max = GL_MAX
+		};
+	}
+
+	/*
+		Fixed-function pipeline state
+
+		Depth, stencil, culling, blending and color writes bundled into one
+		value. A default constructed state matches a fresh context, and every
+		setter returns a modified copy, so states are built once up front:
+
+			const PipelineState mirror = PipelineState()
+				.Enable( Capability::DepthTest )
+				.Enable( Capability::StencilTest )
+				.StencilFunc( TestFunction::Equal, 1 );
+
+		Context::SetPipelineState() compares against the state it applied
+		last and only makes the calls for the parts that differ. Hash() is
+		what RenderQueue folds into its sort key.
+	*/
+	class PipelineState
+	{
+	public:
+		PipelineState();
+
+		PipelineState Enable( Capability::capability_t capability ) const;
+		PipelineState Disable( Capability::capability_t capability ) const;
+
+		PipelineState DepthFunc( TestFunction::test_function_t function ) const;
+		PipelineState DepthMask( bool writeEnabled ) const;
+
+		PipelineState StencilFunc( TestFunction::test_function_t function, int reference, uint mask = ~0 ) const;
+		PipelineState StencilOp( StencilAction::stencil_action_t fail, StencilAction::stencil_action_t zfail, StencilAction::stencil_action_t pass ) const;
+		PipelineState StencilMask( uint mask ) const;
+
+		PipelineState CullFace( Face::face_t face ) const;
+
+		PipelineState BlendFunc( BlendFactor::blend_factor_t source, BlendFactor::blend_factor_t destination ) const;
+		PipelineState BlendEquation( BlendEquation::blend_equation_t equation ) const;
+
+		PipelineState ColorMask( bool red, bool green, bool blue, bool alpha ) const;
+
+		bool IsEnabled( Capability::capability_t capability ) const;
+
+		uint64_t Hash() const;
+
+		bool operator==( const PipelineState& other ) const;
+		bool operator!=( const PipelineState& other ) const;
+
+	private:
+		friend class StateCache;
+
+		// Only 32-bit fields, so there is no padding to get in the way of comparing bytes
+		uint32_t capabilities;
+		uint32_t depthMask;
+		uint32_t depthFunction;
+		uint32_t stencilMask;
+		uint32_t stencilFunction;
+		int32_t stencilReference;
+		uint32_t stencilFuncMask;
+		uint32_t stencilFail, stencilZFail, stencilPass;
+		uint32_t cullFace;
+		uint32_t blendSource, blendDestination, blendEquation;
+		uint32_t colorMask;
+	};
+}
+
+#endif
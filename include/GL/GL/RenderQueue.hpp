@@ -0,0 +1,124 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_RENDERQUEUE_HPP
+#define OOGL_RENDERQUEUE_HPP
+
+#include <GL/Platform.hpp>
+#include <GL/GL/Context.hpp>
+#include <GL/GL/VertexBuffer.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace GL
+{
+	/*
+		Recorded draw call
+
+		Only object names are stored, so the wrappers have to stay alive until
+		the queue is submitted. Texture units with name 0 are left as they are.
+		Pipeline states are kept by the queue, the command holds an index.
+	*/
+	struct DrawCommand
+	{
+		static const uint MaxTextures = 4;
+
+		uint64_t key;
+
+		GLuint program;
+		GLuint vao;
+		GLuint textures[MaxTextures];
+		GLuint uniformBuffer;
+		uint pipeline; // Index + 1 into the queue's states, 0 leaves the state as it is
+
+		Primitive::primitive_t mode;
+		intptr_t offset;
+		uint count;
+		GLenum indexType; // 0 for non-indexed draws
+	};
+
+	/*
+		Draw call queue
+
+		Draws are recorded with the pipeline state, textures and uniform block
+		set beforehand and submitted ordered by a 64-bit key, so that draws
+		sharing a pipeline state, program, textures and vertex array end up
+		next to each other:
+
+			layer (8) | pipeline (8) | program (16) | textures (12) | uniform block (8) | vertex array (12)
+
+		The layer comes first so passes that depend on order (opaque before
+		transparent, say) stay apart; within equal keys the recording order is
+		kept. Names and the pipeline state's hash are folded into their bits,
+		a collision only costs a state change. The uniform block goes to
+		binding point 0. Submit() counts the state changes the recorded order
+		would have made next to the ones the sorted order makes.
+	*/
+	class RenderQueue
+	{
+	public:
+		struct Stats
+		{
+			uint commands;
+			uint changesUnsorted;
+			uint changesSorted;
+		};
+
+		RenderQueue( uint reserve = 1024 );
+
+		void SetLayer( uchar layer );
+		void SetPipelineState( const PipelineState& state );
+		void BindTexture( const Texture& texture, uchar unit );
+		void BindUniformBuffer( const VertexBuffer& buffer );
+		void ResetBindings();
+
+		void DrawArrays( const Program& program, const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices );
+		void DrawElements( const Program& program, const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type );
+
+		void Submit();
+		void Clear();
+
+		uint GetCommandCount() const { return (uint)commands.size(); }
+		const Stats& GetStats() const { return stats; }
+
+		static uint64_t MakeKey( uchar layer, uint64_t pipelineHash, const DrawCommand& command );
+		static uint CountStateChanges( const DrawCommand* const* commands, uint count );
+
+	private:
+		std::vector<DrawCommand> commands;
+		std::vector<std::pair<uint64_t, uint>> order;
+		std::vector<const DrawCommand*> sorted;
+		std::vector<PipelineState> pipelines;
+
+		uchar layer;
+		uint pipeline;
+		GLuint textures[DrawCommand::MaxTextures];
+		GLuint uniformBuffer;
+
+		Stats stats;
+
+		void Record( const Program& program, const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, GLenum indexType );
+	};
+}
+
+#endif
@@ -31,23 +31,13 @@ namespace GL
 	/*
 		Render buffer
 	*/
-	class Renderbuffer
+	class Renderbuffer : public GLObject<RenderbufferTraits>
 	{
 	public:
 		Renderbuffer();
-		Renderbuffer( const Renderbuffer& other );
 		Renderbuffer( uint width, uint height, InternalFormat::internal_format_t format );
 
-		~Renderbuffer();
-
-		operator GLuint() const;
-		const Renderbuffer& operator=( const Renderbuffer& other );
-
 		void Storage( uint width, uint height, InternalFormat::internal_format_t format );
-
-	private:
-		static GC gc;
-		GLuint obj;
 	};
 }
 
@@ -0,0 +1,98 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_STATECACHE_HPP
+#define OOGL_STATECACHE_HPP
+
+#include <GL/Platform.hpp>
+#include <cstdint>
+
+namespace GL
+{
+	class PipelineState;
+
+	/*
+		Redundant state elimination
+
+		Shadows the bindings and fixed-function state of the context that is
+		current on the calling thread and skips calls that would not change
+		anything. Everything starts out unknown, so the first call of each kind
+		always reaches the driver. Bindings are forgotten whenever the GC has
+		deleted names, because a deleted name may be handed out again.
+
+		Context and the wrappers go through here; call Invalidate() after
+		changing state with raw OpenGL calls. The getters let code that has to
+		bind an object to edit it put the old binding back without glGet, and
+		return Unknown when the cache can't tell.
+
+		SetPipelineState() remembers the state it applied, so applying the
+		same one again costs a compare until some of it is set piecemeal.
+	*/
+	class StateCache
+	{
+	public:
+		struct Stats
+		{
+			uint64_t issued;
+			uint64_t skipped;
+		};
+
+		static const uint TextureUnits = 32;
+		static const uint UniformBufferBindings = 16;
+		static const GLuint Unknown = ~0u;
+
+		static void UseProgram( GLuint program );
+		static void BindVertexArray( GLuint vao );
+		static void BindTexture( uint unit, GLuint texture );
+		static void BindFramebuffer( GLuint framebuffer );
+		static void BindUniformBuffer( uint index, GLuint buffer );
+		static void BindDrawIndirectBuffer( GLuint buffer );
+
+		static uint GetActiveUnit();
+		static GLuint GetTexture( uint unit );
+		static GLuint GetFramebuffer();
+
+		// Bit of a capability in the cached masks, shared with PipelineState; 0 if it isn't cached
+		static uint CapabilityBit( GLenum capability );
+
+		static void SetCapability( GLenum capability, bool enabled );
+		static void DepthMask( bool writeEnabled );
+		static void StencilMask( uint mask );
+		static void StencilFunc( GLenum function, int reference, uint mask );
+		static void StencilOp( GLenum fail, GLenum zfail, GLenum pass );
+		static void DepthFunc( GLenum function );
+		static void CullFace( GLenum face );
+		static void BlendFunc( GLenum source, GLenum destination );
+		static void BlendEquation( GLenum equation );
+		static void ColorMask( uint mask );
+		static void SetPipelineState( const PipelineState& pipeline );
+		static void Viewport( int x, int y, int width, int height );
+
+		static void Invalidate();
+
+		static Stats GetStats();
+		static void ResetStats();
+	};
+}
+
+#endif
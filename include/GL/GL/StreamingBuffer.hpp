@@ -0,0 +1,91 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_STREAMINGBUFFER_HPP
+#define OOGL_STREAMINGBUFFER_HPP
+
+#include <GL/GL/VertexBuffer.hpp>
+#include <GL/GL/Fence.hpp>
+#include <vector>
+
+namespace GL
+{
+	/*
+		Streaming buffer
+
+		Ring of per-frame regions for geometry that is rewritten every frame,
+		like particles, UI or debug lines. Allocate() returns where to write
+		the data and the offset to draw it from. With buffer storage the
+		buffer is mapped once, persistently and coherently, and each region is
+		fenced when its frame ends: the first allocation in a region only
+		waits if the GPU is still reading it from the last time around.
+
+		Without buffer storage, or if the persistent mapping fails, the
+		allocations are written to a staging copy and Flush() uploads them
+		through an unsynchronized mapping, orphaning the buffer whenever the
+		ring wraps. Call Flush() before drawing from this frame's allocations
+		and EndFrame() once they have all been submitted. Alignment applies to
+		the offset into the whole buffer. An allocation that doesn't fit in
+		what is left of the frame's region returns a null pointer.
+
+		The buffer itself is only reachable through GetBuffer() to draw from:
+		persistent storage is immutable and stays mapped, so the VertexBuffer
+		calls that reallocate or map it would fail.
+	*/
+	class StreamingBuffer : private VertexBuffer
+	{
+	public:
+		struct Allocation
+		{
+			void* pointer;
+			size_t offset;
+		};
+
+		StreamingBuffer( size_t frameSize, uint frames = 3 );
+
+		Allocation Allocate( size_t bytes, size_t alignment = 16 );
+		void Flush();
+		void EndFrame();
+
+		const VertexBuffer& GetBuffer() const { return *this; }
+		size_t GetFrameSize() const { return frameSize; }
+		uint GetFrameCount() const { return frames; }
+		size_t GetUsed() const { return used; }
+		bool IsPersistent() const { return persistent; }
+
+	private:
+		StreamingBuffer( const StreamingBuffer& );
+		const StreamingBuffer& operator=( const StreamingBuffer& );
+
+		size_t frameSize;
+		uint frames, frame;
+		size_t used, flushed;
+		bool persistent, orphan;
+
+		uchar* mapping;
+		std::vector<uchar> staging;
+		std::vector<Fence> fences;
+	};
+}
+
+#endif
@@ -1,121 +1,174 @@
-/*
-	Copyright (C) 2012 Alexander Overvoorde
-
-	Permission is hereby granted, free of charge, to any person obtaining a copy of
-	this software and associated documentation files (the "Software"), to deal in
-	the Software without restriction, including without limitation the rights to
-	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
-	the Software, and to permit persons to whom the Software is furnished to do so,
-	subject to the following conditions:
-
-	The above copyright notice and this permission notice shall be included in all
-	copies or substantial portions of the Software.
-
-	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
-	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
-	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
-	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
-	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
-*/
-
-#pragma once
-
-#ifndef OOGL_VERTEXBUFFER_HPP
-#define OOGL_VERTEXBUFFER_HPP
-
-#include <GL/Platform.hpp>
-#include <GL/GL/GC.hpp>
-
-#if !defined(__GLEW_H__)
- #include <GL/GL/Extensions.hpp>
-#endif
-
-#include <GL/Util/Mesh.hpp>
-#include <GL/Math/Vec4.hpp>
-#include <functional>
-#include <cstdint>
-
-namespace GL
-{
-	/*
-		Buffer usage types
-	*/
-	namespace BufferUsage
-	{
-		enum buffer_usage_t
-		{
-			StreamDraw = GL_STREAM_DRAW,
-			StreamRead = GL_STREAM_READ,
-			StreamCopy = GL_STREAM_COPY,
-			StaticDraw = GL_STATIC_DRAW,
-			StaticRead = GL_STATIC_READ,
-			StaticCopy = GL_STATIC_COPY,
-			DynamicDraw = GL_DYNAMIC_DRAW,
-			DynamicRead = GL_DYNAMIC_READ,
-			DynamicCopy = GL_DYNAMIC_COPY
-		};
-	}
-
-	/*
-		Helper class for building vertex data
-	*/
-	class VertexDataBuffer
-	{
-	public:
-		void Float( float v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		void Int8( int8_t v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		void Int16( int16_t v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		void Int32( int32_t v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		void Uint8( uint8_t v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		void Uint16( uint16_t v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		void Uint32( uint32_t v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		
-		void Vec2( const Vec2& v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		void Vec3( const Vec3& v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-		void Vec4( const Vec4& v ) { Bytes( (uchar*)&v, sizeof( v ) ); }
-
-		void* Pointer() { return &data[0]; }
-		size_t Size() { return data.size(); }
-
-	private:
-		std::vector<uchar> data;
-
-		void Bytes( uchar* bytes, uint count ) {
-			for ( uint i = 0; i < count; i++ )
-				data.push_back( bytes[i] );
-		}
-	};
-
-	/*
-		Vertex Buffer
-	*/
-	class VertexBuffer
-	{
-	public:
-		VertexBuffer();
-		VertexBuffer( const VertexBuffer& other );
-		VertexBuffer( const void* data, size_t length, BufferUsage::buffer_usage_t usage );
-		VertexBuffer( const Mesh& mesh, BufferUsage::buffer_usage_t usage, std::function<void ( const Vertex& v, VertexDataBuffer& data )> f );
-
-		~VertexBuffer();
-
-		operator GLuint() const;
-		const VertexBuffer& operator=( const VertexBuffer& other );
-
-		void Data( const void* data, size_t length, BufferUsage::buffer_usage_t usage );
-		void SubData( const void* data, size_t offset, size_t length );
-
-		void GetSubData( void* data, size_t offset, size_t length );
-
-	private:
-		GLuint m_ID{ 0 };
-
-		static GC gc;
-		std::function<void(GLsizei, ID*)> m_GeneratorFunc{ glGenBuffers };
-		std::function<void(GLsizei, const ID*)> m_DeleterFunc{ glDeleteBuffers };
-
-	};
-}
-
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_VERTEXBUFFER_HPP
+#define OOGL_VERTEXBUFFER_HPP
+
+#include <GL/Platform.hpp>
+#include <GL/GL/GLObject.hpp>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+#include <GL/Util/Mesh.hpp>
+#include <GL/Math/Vec4.hpp>
+#include <functional>
+#include <memory>
+#include <cstring>
+#include <cstdint>
+
+namespace GL
+{
+	/*
+		Buffer usage types
+	*/
+	namespace BufferUsage
+	{
+		enum buffer_usage_t
+		{
+			StreamDraw = GL_STREAM_DRAW,
+			StreamRead = GL_STREAM_READ,
+			StreamCopy = GL_STREAM_COPY,
+			StaticDraw = GL_STATIC_DRAW,
+			StaticRead = GL_STATIC_READ,
+			StaticCopy = GL_STATIC_COPY,
+			DynamicDraw = GL_DYNAMIC_DRAW,
+			DynamicRead = GL_DYNAMIC_READ,
+			DynamicCopy = GL_DYNAMIC_COPY
+		};
+	}
+
+	/*
+		Buffer mapping access
+
+		InvalidateRange and InvalidateBuffer let the driver drop the old
+		contents instead of keeping them around for the GPU. Unsynchronized
+		skips waiting for draws still reading the buffer, so the caller has to
+		know they don't touch the mapped range. With FlushExplicit, written
+		ranges only reach the GPU when passed to FlushMappedRange().
+	*/
+	namespace MapAccess
+	{
+		enum map_access_t
+		{
+			Read = GL_MAP_READ_BIT,
+			Write = GL_MAP_WRITE_BIT,
+			InvalidateRange = GL_MAP_INVALIDATE_RANGE_BIT,
+			InvalidateBuffer = GL_MAP_INVALIDATE_BUFFER_BIT,
+			FlushExplicit = GL_MAP_FLUSH_EXPLICIT_BIT,
+			Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT
+		};
+
+		inline map_access_t operator|( map_access_t lft, map_access_t rht )
+		{
+			return (map_access_t)( (int)lft | (int)rht );
+		}
+	}
+
+	/*
+		Helper class for building vertex data
+
+		Every value is appended with a single copy. By default the data goes
+		to an array that doubles when full; reserve the expected size up
+		front to avoid that. Given a pointer and a capacity, like a mapped
+		buffer or a StreamingBuffer allocation, it writes straight to that
+		memory instead. Writes that don't fit there are dropped and reported
+		by Overflowed().
+	*/
+	class VertexDataBuffer
+	{
+	public:
+		VertexDataBuffer();
+		explicit VertexDataBuffer( size_t capacity );
+		VertexDataBuffer( void* target, size_t capacity );
+
+		void Float( float v ) { Bytes( &v, sizeof( v ) ); }
+		void Int8( int8_t v ) { Bytes( &v, sizeof( v ) ); }
+		void Int16( int16_t v ) { Bytes( &v, sizeof( v ) ); }
+		void Int32( int32_t v ) { Bytes( &v, sizeof( v ) ); }
+		void Uint8( uint8_t v ) { Bytes( &v, sizeof( v ) ); }
+		void Uint16( uint16_t v ) { Bytes( &v, sizeof( v ) ); }
+		void Uint32( uint32_t v ) { Bytes( &v, sizeof( v ) ); }
+		
+		void Vec2( const Vec2& v ) { Bytes( &v, sizeof( v ) ); }
+		void Vec3( const Vec3& v ) { Bytes( &v, sizeof( v ) ); }
+		void Vec4( const Vec4& v ) { Bytes( &v, sizeof( v ) ); }
+
+		void Bytes( const void* bytes, size_t count )
+		{
+			if ( (size_t)( end - cursor ) < count && !Grow( count ) ) return;
+			memcpy( cursor, bytes, count );
+			cursor += count;
+		}
+
+		void Reserve( size_t bytes );
+		void Clear() { cursor = begin; overflow = false; }
+
+		void* Pointer() { return begin; }
+		size_t Size() const { return cursor - begin; }
+		size_t Capacity() const { return end - begin; }
+		bool Overflowed() const { return overflow; }
+
+	private:
+		VertexDataBuffer( const VertexDataBuffer& );
+		const VertexDataBuffer& operator=( const VertexDataBuffer& );
+
+		std::unique_ptr<uchar[]> data;
+		uchar* begin;
+		uchar* cursor;
+		uchar* end;
+		bool external, overflow;
+
+		bool Grow( size_t count );
+	};
+
+	/*
+		Vertex Buffer
+	*/
+	class VertexBuffer : public GLObject<BufferTraits>
+	{
+	public:
+		VertexBuffer();
+		VertexBuffer( const void* data, size_t length, BufferUsage::buffer_usage_t usage );
+		VertexBuffer( const Mesh& mesh, BufferUsage::buffer_usage_t usage, std::function<void ( const Vertex& v, VertexDataBuffer& data )> f );
+
+		// Writes the vertices straight into the mapped buffer, stride is the number of bytes f writes per vertex
+		VertexBuffer( const Mesh& mesh, size_t stride, BufferUsage::buffer_usage_t usage, std::function<void ( const Vertex& v, VertexDataBuffer& data )> f );
+
+		void Data( const void* data, size_t length, BufferUsage::buffer_usage_t usage );
+		void SubData( const void* data, size_t offset, size_t length );
+
+		void GetSubData( void* data, size_t offset, size_t length );
+
+		// Maps the buffer to write or read it in place, null if it has no storage or the driver refused
+		void* Map( MapAccess::map_access_t access );
+		void* MapRange( size_t offset, size_t length, MapAccess::map_access_t access );
+		void FlushMappedRange( size_t offset, size_t length );
+
+		// Returns false if the contents were lost while mapped and have to be written again
+		bool Unmap();
+	};
+}
+
 #endif
\ No newline at end of file
@@ -62,6 +62,17 @@
 #include <GL/GL/VertexArray.hpp>
 #include <GL/GL/Texture.hpp>
 #include <GL/GL/Framebuffer.hpp>
+#include <GL/GL/DrawIndirectBuffer.hpp>
+#include <GL/GL/RenderQueue.hpp>
+#include <GL/GL/CommandList.hpp>
+#include <GL/GL/Features.hpp>
+#include <GL/GL/Memory.hpp>
+#include <GL/GL/GpuProfiler.hpp>
+#include <GL/GL/PipelineState.hpp>
+#include <GL/GL/Fence.hpp>
+#include <GL/GL/StreamingBuffer.hpp>
+#include <GL/GL/AsyncReadback.hpp>
+#include <GL/GL/GeometryArena.hpp>
 
 /*
 	Utilities
@@ -70,5 +81,6 @@
 #include <GL/Util/Color.hpp>
 #include <GL/Util/Image.hpp>
 #include <GL/Util/Mesh.hpp>
+#include <GL/Util/Profiler.hpp>
 
 #endif
\ No newline at end of file
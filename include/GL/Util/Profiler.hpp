@@ -0,0 +1,111 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#pragma once
+
+#ifndef OOGL_PROFILER_HPP
+#define OOGL_PROFILER_HPP
+
+#include <GL/Platform.hpp>
+#include <cstdint>
+#include <string>
+#include <chrono>
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+	#include <intrin.h>
+	#define OOGL_PROFILE_TSC
+#elif defined( __x86_64__ ) || defined( __i386__ )
+	#include <x86intrin.h>
+	#define OOGL_PROFILE_TSC
+#endif
+
+/*
+	Instrumentation
+
+	OOGL_PROFILE_SCOPE( "Name" ) times the rest of the enclosing block. The
+	macros only expand to anything when OOGL_PROFILE is defined, otherwise
+	they compile to nothing at all.
+*/
+#if defined( OOGL_PROFILE )
+	#define OOGL_PROFILE_JOIN2( a, b ) a##b
+	#define OOGL_PROFILE_JOIN( a, b ) OOGL_PROFILE_JOIN2( a, b )
+	#define OOGL_PROFILE_SCOPE( name ) GL::ProfileScope OOGL_PROFILE_JOIN( profileScope, __LINE__ )( name )
+#else
+	#define OOGL_PROFILE_SCOPE( name )
+#endif
+
+namespace GL
+{
+	/*
+		CPU profiler
+
+		Every thread writes its scopes to a ring buffer of its own, so
+		recording takes no locks; only a thread's first scope registers its
+		buffer. Once a ring is full the oldest events are overwritten. Scopes
+		are stamped with the raw time stamp counter where there is one, and
+		converted to nanoseconds only on export.
+		Exporting and clearing touch all rings and are meant for when the
+		instrumented threads are idle, as events being written at that
+		moment may come out torn. Names must be string literals or otherwise
+		live until the export.
+	*/
+	class Profiler
+	{
+	public:
+		static const uint EventsPerThread = 16384;
+
+		static int64_t Now();
+
+		// Raw timestamp in an unspecified unit, as stored by Record()
+		static int64_t Ticks()
+		{
+#if defined( OOGL_PROFILE_TSC )
+			return (int64_t)__rdtsc();
+#else
+			return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+		}
+
+		static void Record( const char* name, int64_t startTicks, int64_t endTicks );
+
+		// Chrome / Perfetto trace event JSON, see chrome://tracing
+		static std::string GetChromeTrace();
+		static bool WriteChromeTrace( const std::string& filename );
+
+		static void Clear();
+	};
+
+	class ProfileScope
+	{
+	public:
+		ProfileScope( const char* name ) : name( name ), start( Profiler::Ticks() ) {}
+		~ProfileScope() { Profiler::Record( name, start, Profiler::Ticks() ); }
+
+	private:
+		const char* name;
+		int64_t start;
+
+		ProfileScope( const ProfileScope& );
+		const ProfileScope& operator=( const ProfileScope& );
+	};
+}
+
+#endif
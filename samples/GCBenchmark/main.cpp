@@ -0,0 +1,125 @@
+#include <GL/GL/GC.hpp>
+#include <unordered_map>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <cstdio>
+
+// Reference counting as it was done before the slot table, kept here for comparison
+class MapGC
+{
+public:
+	GL::ID Create( GL::ID id ) { refs.insert( std::pair<GL::ID, uint16_t>( id, 1 ) ); return id; }
+	void Copy( GL::ID& dst, const GL::ID& src ) { dst = src; refs[dst]++; }
+	void Destroy( GL::ID& obj ) { if ( --refs[obj] == 0 ) { refs.erase( obj ); obj = 0; } }
+
+private:
+	std::unordered_map<GL::ID, uint16_t> refs;
+};
+
+GL::ID nextName = 1;
+void FakeGenerate( GLsizei n, GL::ID* ids ) { for ( GLsizei i = 0; i < n; i++ ) ids[i] = nextName++; }
+void FakeDelete( GLsizei, const GL::ID* ) {}
+
+const GL::uint objectCount = 100000;
+const GL::uint copiesPerObject = 8;
+const GL::uint rounds = 10;
+const GL::uint threadCount = 4;
+
+double Seconds( std::chrono::high_resolution_clock::time_point start )
+{
+	return std::chrono::duration<double>( std::chrono::high_resolution_clock::now() - start ).count();
+}
+
+int main()
+{
+	// Copies reference objects in a scattered order, like wrappers copied around a scene graph
+	std::vector<GL::uint> order( objectCount * copiesPerObject );
+	GL::uint seed = 12345;
+	for ( GL::uint i = 0; i < order.size(); i++ ) {
+		seed = seed * 1664525 + 1013904223;
+		order[i] = seed % objectCount;
+	}
+
+	// Object names are faked, so no OpenGL context is needed
+	std::vector<GL::ID> ids( objectCount );
+	std::vector<GL::ID> mapCopies( objectCount * copiesPerObject );
+
+	auto start = std::chrono::high_resolution_clock::now();
+	for ( GL::uint r = 0; r < rounds; r++ )
+	{
+		MapGC gc;
+		for ( GL::uint i = 0; i < objectCount; i++ )
+			ids[i] = gc.Create( i + 1 );
+		for ( GL::uint i = 0; i < objectCount * copiesPerObject; i++ )
+			gc.Copy( mapCopies[i], ids[order[i]] );
+		for ( GL::uint i = 0; i < objectCount * copiesPerObject; i++ )
+			gc.Destroy( mapCopies[i] );
+		for ( GL::uint i = 0; i < objectCount; i++ )
+			gc.Destroy( ids[i] );
+	}
+	double mapTime = Seconds( start );
+
+	std::vector<GL::GC::Handle> handles( objectCount );
+	std::vector<GL::GC::Handle> slotCopies( objectCount * copiesPerObject );
+	GL::ID id;
+
+	start = std::chrono::high_resolution_clock::now();
+	for ( GL::uint r = 0; r < rounds; r++ )
+	{
+		GL::GC gc;
+		for ( GL::uint i = 0; i < objectCount; i++ )
+			gc.Create( handles[i], i + 1 );
+		for ( GL::uint i = 0; i < objectCount * copiesPerObject; i++ )
+			gc.Copy( slotCopies[i], handles[order[i]] );
+		for ( GL::uint i = 0; i < objectCount * copiesPerObject; i++ )
+			gc.Release( slotCopies[i], id );
+		for ( GL::uint i = 0; i < objectCount; i++ )
+			gc.Release( handles[i], id );
+	}
+	double slotTime = Seconds( start );
+
+	// Pooled names, counting the driver calls a glGen/glDelete per object would have made
+	GL::GC pooled( FakeGenerate, FakeDelete, 256 );
+	for ( GL::uint i = 0; i < objectCount; i++ )
+		pooled.Create( handles[i] );
+	for ( GL::uint i = 0; i < objectCount; i++ )
+		if ( pooled.Release( handles[i], id ) ) pooled.Retire( id );
+	pooled.Flush();
+
+	// The same churn from several loader threads sharing one collector
+	GL::GC shared;
+	start = std::chrono::high_resolution_clock::now();
+	std::vector<std::thread> threads;
+	for ( GL::uint t = 0; t < threadCount; t++ )
+	{
+		threads.push_back( std::thread( [&shared, &order, t] () {
+			std::vector<GL::GC::Handle> handles( objectCount / threadCount );
+			std::vector<GL::GC::Handle> copies( handles.size() * copiesPerObject );
+			GL::ID id;
+
+			for ( GL::uint i = 0; i < handles.size(); i++ )
+				shared.Create( handles[i], t * objectCount + i + 1 );
+			for ( GL::uint i = 0; i < copies.size(); i++ )
+				shared.Copy( copies[i], handles[order[i] % handles.size()] );
+			for ( GL::uint i = 0; i < copies.size(); i++ )
+				shared.Release( copies[i], id );
+			for ( GL::uint i = 0; i < handles.size(); i++ )
+				shared.Release( handles[i], id );
+		} ) );
+	}
+	for ( GL::uint t = 0; t < threadCount; t++ )
+		threads[t].join();
+	double threadedTime = Seconds( start );
+
+	GL::uint operations = rounds * objectCount * ( 2 + 2 * copiesPerObject );
+	printf( "map:       %8.2f ms (%6.1f ns/op)\n", mapTime * 1000.0, mapTime * 1e9 / operations );
+	printf( "slot map:  %8.2f ms (%6.1f ns/op)\n", slotTime * 1000.0, slotTime * 1e9 / operations );
+	printf( "threaded:  %8.2f ms (%u threads, %u objects left)\n", threadedTime * 1000.0, threadCount, shared.GetObjectCount() );
+
+	GL::GC::Stats stats = pooled.GetStats();
+	printf( "pool:      %u names in %u glGen calls, %u names in %u glDelete calls (%u calls saved)\n",
+		stats.namesGenerated, stats.generateCalls, stats.namesDeleted, stats.deleteCalls, stats.SavedCalls() );
+
+	return 0;
+}
@@ -0,0 +1,52 @@
+#include <GL/OOGL.hpp>
+#include <vector>
+#include <cstdio>
+
+// Renders a thumbnail without a window or X server and saves it to thumbnail.png
+int main()
+{
+	const GL::uint width = 256, height = 256;
+
+	GL::Context* gl = GL::Context::CreateHeadless();
+	printf( "Rendering with %s\n", glGetString( GL_RENDERER ) );
+
+	GL::Shader vert( GL::ShaderType::Vertex, "#version 150\nin vec2 position; in vec3 color; out vec3 Color; void main() { Color = color; gl_Position = vec4( position, 0.0, 1.0 ); }" );
+	GL::Shader frag( GL::ShaderType::Fragment, "#version 150\nin vec3 Color; out vec4 outColor; void main() { outColor = vec4( Color, 1.0 ); }" );
+	GL::Program program( vert, frag );
+
+	float vertices[] = {
+		 0.0f,  0.8f, 1.0f, 0.0f, 0.0f,
+		 0.8f, -0.8f, 0.0f, 1.0f, 0.0f,
+		-0.8f, -0.8f, 0.0f, 0.0f, 1.0f
+	};
+	GL::VertexBuffer vbo( vertices, sizeof( vertices ), GL::BufferUsage::StaticDraw );
+
+	GL::VertexArray vao;
+	vao.BindAttribute( program.GetAttribute( "position" ), vbo, GL::Type::Float, 2, 5 * sizeof( float ), 0 );
+	vao.BindAttribute( program.GetAttribute( "color" ), vbo, GL::Type::Float, 3, 5 * sizeof( float ), 2 * sizeof( float ) );
+
+	// There is no default framebuffer to draw to
+	GL::Framebuffer fb( width, height );
+	gl->BindFramebuffer( fb );
+
+	gl->ClearColor( GL::Color( 32, 32, 32 ) );
+	gl->Clear();
+	gl->UseProgram( program );
+	gl->DrawArrays( vao, GL::Primitive::Triangles, 0, 3 );
+
+	// Read back, the bottom row comes first
+	std::vector<GL::uchar> pixels( width * height * 4 ), flipped( width * height * 4 );
+	glBindFramebuffer( GL_READ_FRAMEBUFFER, fb );
+	glReadPixels( 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0] );
+
+	for ( GL::uint y = 0; y < height; y++ )
+		std::copy( &pixels[( height - 1 - y ) * width * 4], &pixels[( height - y ) * width * 4], &flipped[y * width * 4] );
+
+	GL::Image thumbnail( width, height, &flipped[0] );
+	thumbnail.Save( "thumbnail.png", GL::ImageFileFormat::PNG );
+
+	gl->EndFrame();
+	delete gl;
+
+	return 0;
+}
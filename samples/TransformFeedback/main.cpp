@@ -38,6 +38,9 @@ int main()
 	GL::VertexBuffer outBuffer(nullptr, sizeof(vertices), GL::BufferUsage::StaticDraw);
 	vao.BindTransformFeedback(0, outBuffer);
 
+	// Result is copied back without waiting for the GPU
+	GL::AsyncReadback readback;
+
 	bool once = true;
 
     GL::Event ev;
@@ -54,11 +57,17 @@ int main()
 		
 			gl.Disable(GL::Capability::RasterizerDiscard);
 
+			readback.Read(outBuffer, 0, sizeof(vertices));
+
+			once = false;
+		}
+
+		if (readback.IsReady()) {
 			float result[6];
-			outBuffer.GetSubData(result, 0, sizeof(vertices));
+			readback.GetData(result);
 			printf("%f, %f\n%f, %f\n%f, %f\n", result[0], result[1], result[2], result[3], result[4], result[5]);
 
-			once = false;
+			readback.Reset();
 		}
 
         window.Present();
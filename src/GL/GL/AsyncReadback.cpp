@@ -0,0 +1,157 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/AsyncReadback.hpp>
+#include <cstring>
+
+namespace GL
+{
+	static size_t PixelSize( GLenum format, GLenum type )
+	{
+		switch ( type )
+		{
+			case GL_UNSIGNED_BYTE_3_3_2:
+			case GL_UNSIGNED_BYTE_2_3_3_REV:
+				return 1;
+			case GL_UNSIGNED_SHORT_5_6_5:
+			case GL_UNSIGNED_SHORT_4_4_4_4:
+			case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+			case GL_UNSIGNED_SHORT_5_5_5_1:
+			case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+				return 2;
+			case GL_UNSIGNED_INT_8_8_8_8:
+			case GL_UNSIGNED_INT_8_8_8_8_REV:
+			case GL_UNSIGNED_INT_10_10_10_2:
+				return 4;
+		}
+
+		size_t components = 1;
+		if ( format == GL_RGB || format == GL_BGR ) components = 3;
+		else if ( format == GL_RGBA || format == GL_BGRA ) components = 4;
+
+		if ( type == GL_SHORT || type == GL_UNSIGNED_SHORT || type == GL_HALF_FLOAT ) return components * 2;
+		if ( type == GL_INT || type == GL_UNSIGNED_INT || type == GL_FLOAT ) return components * 4;
+		if ( type == GL_DOUBLE ) return components * 8;
+		return components;
+	}
+
+	AsyncReadback::AsyncReadback()
+		: size( 0 ), capacity( 0 ), pending( false )
+	{
+	}
+
+	void AsyncReadback::Read( const VertexBuffer& source, size_t offset, size_t length )
+	{
+		Reserve( length );
+
+		glBindBuffer( GL_COPY_READ_BUFFER, source );
+		glBindBuffer( GL_COPY_WRITE_BUFFER, buffer );
+		glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, length );
+
+		Submit();
+	}
+
+	void AsyncReadback::ReadColor( const Framebuffer& framebuffer, Format::format_t format, DataType::data_type_t type )
+	{
+		ReadPixels( framebuffer, 0, 0, framebuffer.GetWidth(), framebuffer.GetHeight(), format, type );
+	}
+
+	void AsyncReadback::ReadColor( const Framebuffer& framebuffer, uint x, uint y, uint width, uint height, Format::format_t format, DataType::data_type_t type )
+	{
+		ReadPixels( framebuffer, x, y, width, height, format, type );
+	}
+
+	void AsyncReadback::ReadDepth( const Framebuffer& framebuffer, DataType::data_type_t type )
+	{
+		ReadPixels( framebuffer, 0, 0, framebuffer.GetWidth(), framebuffer.GetHeight(), GL_DEPTH_COMPONENT, type );
+	}
+
+	void AsyncReadback::ReadDepth( const Framebuffer& framebuffer, uint x, uint y, uint width, uint height, DataType::data_type_t type )
+	{
+		ReadPixels( framebuffer, x, y, width, height, GL_DEPTH_COMPONENT, type );
+	}
+
+	const void* AsyncReadback::Map()
+	{
+		if ( !pending ) return 0;
+
+		fence.Wait();
+
+		return buffer.MapRange( 0, size, MapAccess::Read );
+	}
+
+	void AsyncReadback::Unmap()
+	{
+		buffer.Unmap();
+	}
+
+	bool AsyncReadback::GetData( void* data )
+	{
+		const void* result = Map();
+		if ( !result ) return false;
+
+		memcpy( data, result, size );
+		Unmap();
+		return true;
+	}
+
+	void AsyncReadback::Reset()
+	{
+		fence.Reset();
+		pending = false;
+	}
+
+	void AsyncReadback::Reserve( size_t bytes )
+	{
+		size = bytes;
+		if ( bytes <= capacity ) return;
+
+		buffer.Data( 0, bytes, BufferUsage::StreamRead );
+		capacity = bytes;
+	}
+
+	void AsyncReadback::ReadPixels( const Framebuffer& framebuffer, uint x, uint y, uint width, uint height, GLenum format, GLenum type )
+	{
+		size_t row = ( width * PixelSize( format, type ) + 3 ) & ~(size_t)3;
+		Reserve( row * height );
+
+		// The state cache only tracks the draw framebuffer, so the caller's read binding is put back here
+		GLint readFramebuffer;
+		glGetIntegerv( GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer );
+
+		glBindFramebuffer( GL_READ_FRAMEBUFFER, framebuffer );
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, buffer );
+		glReadPixels( x, y, width, height, format, type, 0 );
+		glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+		glBindFramebuffer( GL_READ_FRAMEBUFFER, readFramebuffer );
+
+		Submit();
+	}
+
+	void AsyncReadback::Submit()
+	{
+		fence.Insert();
+		pending = true;
+
+		// Polling never flushes, so the copy is sent off now instead of with the next frame
+		glFlush();
+	}
+}
@@ -0,0 +1,468 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/CommandList.hpp>
+#include <GL/GL/StateCache.hpp>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
+{
+	/*
+		Chunk pool of one recording thread
+
+		Lists are usually reset on the render thread, so chunks are handed
+		back under a lock; taking one is the only other time it is held.
+	*/
+	class CommandArena
+	{
+	public:
+		static const size_t ChunkSize = 64 * 1024;
+
+		~CommandArena()
+		{
+			for ( size_t i = 0; i < chunks.size(); i++ )
+				::operator delete( chunks[i] );
+		}
+
+		static std::shared_ptr<CommandArena> ForThread()
+		{
+			static thread_local std::shared_ptr<CommandArena> arena( new CommandArena() );
+			return arena;
+		}
+
+		uchar* Acquire()
+		{
+			{
+				std::lock_guard<std::mutex> lock( mutex );
+				if ( !chunks.empty() ) {
+					uchar* chunk = chunks.back();
+					chunks.pop_back();
+					return chunk;
+				}
+			}
+
+			return (uchar*)::operator new( ChunkSize );
+		}
+
+		void Release( uchar* chunk )
+		{
+			std::lock_guard<std::mutex> lock( mutex );
+			chunks.push_back( chunk );
+		}
+
+	private:
+		std::mutex mutex;
+		std::vector<uchar*> chunks;
+	};
+
+	/*
+		Command layouts, each starting with its header
+	*/
+	namespace Command
+	{
+		enum command_t
+		{
+			End,
+			UseProgram,
+			BindTexture,
+			BindUniformBuffer,
+			BindFramebuffer,
+			BindDefaultFramebuffer,
+			SetCapability,
+			DepthMask,
+			SetPipelineState,
+			ClearColor,
+			Clear,
+			UniformInt,
+			UniformFloats,
+			Draw,
+			MultiDrawIndirect
+		};
+	}
+
+	struct CommandHeader
+	{
+		uint16_t type;
+		uint16_t size;
+	};
+
+	struct BindCommand { CommandHeader header; GLuint name; uint index; };
+	struct FramebufferCommand { CommandHeader header; GLuint name; uint width, height; };
+	struct CapabilityCommand { CommandHeader header; GLenum capability; bool enabled; };
+	struct PipelineCommand { CommandHeader header; PipelineState state; };
+	struct ColorCommand { CommandHeader header; Color color; };
+	struct ClearCommand { CommandHeader header; GLbitfield buffers; };
+	struct UniformIntCommand { CommandHeader header; Uniform uniform; int value; };
+	struct UniformFloatsCommand { CommandHeader header; Uniform uniform; uint components; float values[16]; };
+
+	struct DrawCommandData
+	{
+		CommandHeader header;
+		GLuint vao;
+		GLenum mode;
+		intptr_t offset;
+		uint count;
+		GLenum indexType; // 0 for non-indexed draws
+		bool instanced; // instances may be 0, which draws nothing
+		uint instances;
+	};
+
+	struct MultiDrawCommand
+	{
+		CommandHeader header;
+		GLuint vao;
+		GLuint buffer;
+		GLenum mode;
+		GLenum indexType;
+		uint count;
+		intptr_t offset;
+		uint stride;
+	};
+
+	static const size_t CommandAlignment = 8;
+
+	CommandList::CommandList()
+		: used( 0 ), commandCount( 0 )
+	{
+	}
+
+	CommandList::~CommandList()
+	{
+		Reset();
+	}
+
+	void* CommandList::Allocate( uint type, size_t size )
+	{
+		size = ( size + CommandAlignment - 1 ) & ~( CommandAlignment - 1 );
+
+		if ( chunks.empty() || used + size > CommandArena::ChunkSize ) {
+			// Mark where the filled chunk ends
+			if ( !chunks.empty() && used + sizeof( CommandHeader ) <= CommandArena::ChunkSize )
+				( (CommandHeader*)( chunks.back() + used ) )->type = Command::End;
+
+			if ( !arena ) arena = CommandArena::ForThread();
+			chunks.push_back( arena->Acquire() );
+			used = 0;
+		}
+
+		CommandHeader* header = (CommandHeader*)( chunks.back() + used );
+		header->type = (uint16_t)type;
+		header->size = (uint16_t)size;
+
+		used += size;
+		commandCount++;
+
+		return header;
+	}
+
+	void CommandList::Reset()
+	{
+		for ( size_t i = 0; i < chunks.size(); i++ )
+			arena->Release( chunks[i] );
+
+		chunks.clear();
+		arena.reset();
+		used = 0;
+		commandCount = 0;
+	}
+
+	void CommandList::UseProgram( const Program& program )
+	{
+		BindCommand* cmd = (BindCommand*)Allocate( Command::UseProgram, sizeof( BindCommand ) );
+		cmd->name = program;
+		cmd->index = 0;
+	}
+
+	void CommandList::BindTexture( const Texture& texture, uchar unit )
+	{
+		BindCommand* cmd = (BindCommand*)Allocate( Command::BindTexture, sizeof( BindCommand ) );
+		cmd->name = texture;
+		cmd->index = unit;
+	}
+
+	void CommandList::BindUniformBuffer( const VertexBuffer& buffer, uint index )
+	{
+		BindCommand* cmd = (BindCommand*)Allocate( Command::BindUniformBuffer, sizeof( BindCommand ) );
+		cmd->name = buffer;
+		cmd->index = index;
+	}
+
+	void CommandList::BindFramebuffer( const Framebuffer& framebuffer )
+	{
+		FramebufferCommand* cmd = (FramebufferCommand*)Allocate( Command::BindFramebuffer, sizeof( FramebufferCommand ) );
+		cmd->name = framebuffer;
+		cmd->width = framebuffer.GetWidth();
+		cmd->height = framebuffer.GetHeight();
+	}
+
+	void CommandList::BindFramebuffer()
+	{
+		Allocate( Command::BindDefaultFramebuffer, sizeof( CommandHeader ) );
+	}
+
+	void CommandList::Enable( Capability::capability_t capability )
+	{
+		CapabilityCommand* cmd = (CapabilityCommand*)Allocate( Command::SetCapability, sizeof( CapabilityCommand ) );
+		cmd->capability = capability;
+		cmd->enabled = true;
+	}
+
+	void CommandList::Disable( Capability::capability_t capability )
+	{
+		CapabilityCommand* cmd = (CapabilityCommand*)Allocate( Command::SetCapability, sizeof( CapabilityCommand ) );
+		cmd->capability = capability;
+		cmd->enabled = false;
+	}
+
+	void CommandList::DepthMask( bool writeEnabled )
+	{
+		CapabilityCommand* cmd = (CapabilityCommand*)Allocate( Command::DepthMask, sizeof( CapabilityCommand ) );
+		cmd->capability = 0;
+		cmd->enabled = writeEnabled;
+	}
+
+	void CommandList::SetPipelineState( const PipelineState& state )
+	{
+		PipelineCommand* cmd = (PipelineCommand*)Allocate( Command::SetPipelineState, sizeof( PipelineCommand ) );
+		cmd->state = state;
+	}
+
+	void CommandList::ClearColor( const Color& col )
+	{
+		ColorCommand* cmd = (ColorCommand*)Allocate( Command::ClearColor, sizeof( ColorCommand ) );
+		cmd->color = col;
+	}
+
+	void CommandList::Clear( Buffer::buffer_t buffers )
+	{
+		ClearCommand* cmd = (ClearCommand*)Allocate( Command::Clear, sizeof( ClearCommand ) );
+		cmd->buffers = buffers;
+	}
+
+	void CommandList::SetUniform( const Uniform& uniform, int value )
+	{
+		UniformIntCommand* cmd = (UniformIntCommand*)Allocate( Command::UniformInt, sizeof( UniformIntCommand ) );
+		cmd->uniform = uniform;
+		cmd->value = value;
+	}
+
+	// Only the used part of the value array is allocated
+	static size_t UniformSize( uint components )
+	{
+		return offsetof( UniformFloatsCommand, values ) + components * sizeof( float );
+	}
+
+	static void FillUniform( void* memory, const Uniform& uniform, uint components, const float* values )
+	{
+		UniformFloatsCommand* cmd = (UniformFloatsCommand*)memory;
+		cmd->uniform = uniform;
+		cmd->components = components;
+		for ( uint i = 0; i < components; i++ ) cmd->values[i] = values[i];
+	}
+
+	void CommandList::SetUniform( const Uniform& uniform, float value )
+	{
+		FillUniform( Allocate( Command::UniformFloats, UniformSize( 1 ) ), uniform, 1, &value );
+	}
+
+	void CommandList::SetUniform( const Uniform& uniform, const Vec2& value )
+	{
+		float values[2] = { value.X, value.Y };
+		FillUniform( Allocate( Command::UniformFloats, UniformSize( 2 ) ), uniform, 2, values );
+	}
+
+	void CommandList::SetUniform( const Uniform& uniform, const Vec3& value )
+	{
+		float values[3] = { value.X, value.Y, value.Z };
+		FillUniform( Allocate( Command::UniformFloats, UniformSize( 3 ) ), uniform, 3, values );
+	}
+
+	void CommandList::SetUniform( const Uniform& uniform, const Vec4& value )
+	{
+		float values[4] = { value.X, value.Y, value.Z, value.W };
+		FillUniform( Allocate( Command::UniformFloats, UniformSize( 4 ) ), uniform, 4, values );
+	}
+
+	void CommandList::SetUniform( const Uniform& uniform, const Mat3& value )
+	{
+		FillUniform( Allocate( Command::UniformFloats, UniformSize( 9 ) ), uniform, 9, value.m );
+	}
+
+	void CommandList::SetUniform( const Uniform& uniform, const Mat4& value )
+	{
+		FillUniform( Allocate( Command::UniformFloats, UniformSize( 16 ) ), uniform, 16, value.m );
+	}
+
+	static void FillDraw( void* memory, GLuint vao, GLenum mode, intptr_t offset, uint count, GLenum indexType, bool instanced, uint instances )
+	{
+		DrawCommandData* cmd = (DrawCommandData*)memory;
+		cmd->vao = vao;
+		cmd->mode = mode;
+		cmd->offset = offset;
+		cmd->count = count;
+		cmd->indexType = indexType;
+		cmd->instanced = instanced;
+		cmd->instances = instances;
+	}
+
+	void CommandList::DrawArrays( const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices )
+	{
+		FillDraw( Allocate( Command::Draw, sizeof( DrawCommandData ) ), vao, mode, offset, vertices, 0, false, 1 );
+	}
+
+	void CommandList::DrawElements( const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type )
+	{
+		FillDraw( Allocate( Command::Draw, sizeof( DrawCommandData ) ), vao, mode, offset, count, type, false, 1 );
+	}
+
+	void CommandList::DrawArraysInstanced( const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices, uint instances )
+	{
+		FillDraw( Allocate( Command::Draw, sizeof( DrawCommandData ) ), vao, mode, offset, vertices, 0, true, instances );
+	}
+
+	void CommandList::DrawElementsInstanced( const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type, uint instances )
+	{
+		FillDraw( Allocate( Command::Draw, sizeof( DrawCommandData ) ), vao, mode, offset, count, type, true, instances );
+	}
+
+	void CommandList::MultiDrawArraysIndirect( const VertexArray& vao, const DrawIndirectBuffer& commands, Primitive::primitive_t mode, uint count, intptr_t offset, uint stride )
+	{
+		MultiDrawElementsIndirect( vao, commands, mode, 0, count, offset, stride );
+	}
+
+	void CommandList::MultiDrawElementsIndirect( const VertexArray& vao, const DrawIndirectBuffer& commands, Primitive::primitive_t mode, uint type, uint count, intptr_t offset, uint stride )
+	{
+		MultiDrawCommand* cmd = (MultiDrawCommand*)Allocate( Command::MultiDrawIndirect, sizeof( MultiDrawCommand ) );
+		cmd->vao = vao;
+		cmd->buffer = commands;
+		cmd->mode = mode;
+		cmd->indexType = type;
+		cmd->count = count;
+		cmd->offset = offset;
+		cmd->stride = stride;
+	}
+
+	void CommandList::Replay( Context& context ) const
+	{
+		for ( size_t c = 0; c < chunks.size(); c++ )
+		{
+			const uchar* chunk = chunks[c];
+			size_t end = c + 1 == chunks.size() ? used : CommandArena::ChunkSize;
+
+			for ( size_t pos = 0; pos + sizeof( CommandHeader ) <= end; )
+			{
+				const CommandHeader* header = (const CommandHeader*)( chunk + pos );
+				if ( header->type == Command::End ) break;
+				pos += header->size;
+
+				switch ( header->type )
+				{
+					case Command::UseProgram:
+						StateCache::UseProgram( ( (const BindCommand*)header )->name );
+						break;
+
+					case Command::BindTexture:
+						StateCache::BindTexture( ( (const BindCommand*)header )->index, ( (const BindCommand*)header )->name );
+						break;
+
+					case Command::BindUniformBuffer:
+						StateCache::BindUniformBuffer( ( (const BindCommand*)header )->index, ( (const BindCommand*)header )->name );
+						break;
+
+					case Command::BindFramebuffer: {
+						const FramebufferCommand* cmd = (const FramebufferCommand*)header;
+						StateCache::BindFramebuffer( cmd->name );
+						StateCache::Viewport( 0, 0, cmd->width, cmd->height );
+						break;
+					}
+
+					case Command::BindDefaultFramebuffer:
+						context.BindFramebuffer();
+						break;
+
+					case Command::SetCapability:
+						StateCache::SetCapability( ( (const CapabilityCommand*)header )->capability, ( (const CapabilityCommand*)header )->enabled );
+						break;
+
+					case Command::DepthMask:
+						StateCache::DepthMask( ( (const CapabilityCommand*)header )->enabled );
+						break;
+
+					case Command::SetPipelineState:
+						StateCache::SetPipelineState( ( (const PipelineCommand*)header )->state );
+						break;
+
+					case Command::ClearColor:
+						context.ClearColor( ( (const ColorCommand*)header )->color );
+						break;
+
+					case Command::Clear:
+						glClear( ( (const ClearCommand*)header )->buffers );
+						break;
+
+					case Command::UniformInt:
+						glUniform1i( ( (const UniformIntCommand*)header )->uniform, ( (const UniformIntCommand*)header )->value );
+						break;
+
+					case Command::UniformFloats: {
+						const UniformFloatsCommand* cmd = (const UniformFloatsCommand*)header;
+						switch ( cmd->components )
+						{
+							case 1: glUniform1f( cmd->uniform, cmd->values[0] ); break;
+							case 2: glUniform2f( cmd->uniform, cmd->values[0], cmd->values[1] ); break;
+							case 3: glUniform3f( cmd->uniform, cmd->values[0], cmd->values[1], cmd->values[2] ); break;
+							case 4: glUniform4f( cmd->uniform, cmd->values[0], cmd->values[1], cmd->values[2], cmd->values[3] ); break;
+							case 9: glUniformMatrix3fv( cmd->uniform, 1, GL_FALSE, cmd->values ); break;
+							case 16: glUniformMatrix4fv( cmd->uniform, 1, GL_FALSE, cmd->values ); break;
+						}
+						break;
+					}
+
+					case Command::Draw: {
+						const DrawCommandData* cmd = (const DrawCommandData*)header;
+						StateCache::BindVertexArray( cmd->vao );
+
+						if ( cmd->indexType ) {
+							if ( cmd->instanced ) glDrawElementsInstanced( cmd->mode, cmd->count, cmd->indexType, (const GLvoid*)cmd->offset, cmd->instances );
+							else glDrawElements( cmd->mode, cmd->count, cmd->indexType, (const GLvoid*)cmd->offset );
+						} else {
+							if ( cmd->instanced ) glDrawArraysInstanced( cmd->mode, (GLint)cmd->offset, cmd->count, cmd->instances );
+							else glDrawArrays( cmd->mode, (GLint)cmd->offset, cmd->count );
+						}
+						break;
+					}
+
+					case Command::MultiDrawIndirect: {
+						const MultiDrawCommand* cmd = (const MultiDrawCommand*)header;
+						Context::MultiDrawIndirect( cmd->vao, cmd->buffer, cmd->mode, cmd->indexType, cmd->count, cmd->offset, cmd->stride );
+						break;
+					}
+				}
+			}
+		}
+	}
+}
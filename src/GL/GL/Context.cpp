@@ -1,137 +1,267 @@
-/*
-	Copyright (C) 2012 Alexander Overvoorde
-
-	Permission is hereby granted, free of charge, to any person obtaining a copy of
-	this software and associated documentation files (the "Software"), to deal in
-	the Software without restriction, including without limitation the rights to
-	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
-	the Software, and to permit persons to whom the Software is furnished to do so,
-	subject to the following conditions:
-
-	The above copyright notice and this permission notice shall be included in all
-	copies or substantial portions of the Software.
-
-	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
-	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
-	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
-	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
-	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
-*/
-
-#include <GL/GL/Context.hpp>
-
-#if !defined(__GLEW_H__)
- #include <GL/GL/Extensions.hpp>
-#endif
-
-namespace GL
-{
-	void Context::Enable( Capability::capability_t capability )
-	{
-		glEnable( capability );
-	}
-
-	void Context::Disable( Capability::capability_t capability )
-	{
-		glDisable( capability );
-	}
-
-	void Context::ClearColor( const Color& col )
-	{
-		glClearColor( col.R / 255.0f, col.G / 255.0f, col.B / 255.0f, col.A / 255.0f );
-	}
-
-	void Context::Clear( Buffer::buffer_t buffers )
-	{
-		glClear( buffers );
-	}
-
-	void Context::DepthMask( bool writeEnabled )
-	{
-		glDepthMask( writeEnabled ? GL_TRUE : GL_FALSE );
-	}
-
-	void Context::StencilMask( bool writeEnabled )
-	{
-		glStencilMask( writeEnabled ? ~0 : 0 );
-	}
-
-	void Context::StencilMask( uint mask )
-	{
-		glStencilMask( mask );
-	}
-
-	void Context::StencilFunc( TestFunction::test_function_t function, int reference, uint mask )
-	{
-		glStencilFunc( function, reference, mask );
-	}
-
-	void Context::StencilOp( StencilAction::stencil_action_t fail, StencilAction::stencil_action_t zfail, StencilAction::stencil_action_t pass )
-	{
-		glStencilOp( fail, zfail, pass );
-	}
-
-	void Context::UseProgram( const Program& program )
-	{
-		glUseProgram( program );
-	}
-
-	void Context::BindTexture( const Texture& texture, uchar unit )
-	{
-		glActiveTexture( GL_TEXTURE0 + unit );
-		glBindTexture( GL_TEXTURE_2D, texture );
-	}
-
-	void Context::BindFramebuffer( const Framebuffer& framebuffer )
-	{
-		glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffer );
-		
-		// Set viewport to frame buffer size
-		GLint obj, width, height;
-		glGetFramebufferAttachmentParameteriv( GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &obj );
-
-		GLint res; glGetIntegerv( GL_TEXTURE_BINDING_2D, &res );
-			glBindTexture( GL_TEXTURE_2D, obj );
-			glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width );
-			glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height );
-		glBindTexture( GL_TEXTURE_2D, res );
-
-		glViewport( 0, 0, width, height );
-	}
-
-	void Context::BindFramebuffer()
-	{
-		glBindFramebuffer( GL_DRAW_FRAMEBUFFER, 0 );
-
-		// Set viewport to default frame buffer size
-		glViewport( defaultViewport[0], defaultViewport[1], defaultViewport[2], defaultViewport[3] );
-	}
-
-	void Context::BeginTransformFeedback( Primitive::primitive_t mode )
-	{
-		glBeginTransformFeedback( mode );
-	}
-
-	void Context::EndTransformFeedback()
-	{
-		glEndTransformFeedback();
-	}
-
-	void Context::DrawArrays( const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices )
-	{
-		glBindVertexArray( vao );
-		glDrawArrays( mode, offset, vertices );
-	}
-
-	void Context::DrawElements( const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type )
-	{
-		glBindVertexArray( vao );
-		glDrawElements( mode, count, type, (const GLvoid*)offset );
-	}
-
-	Context Context::UseExistingContext()
-	{
-		return Context();
-	}
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/Context.hpp>
+#include <GL/GL/StateCache.hpp>
+#include <GL/GL/GC.hpp>
+#include <GL/GL/Features.hpp>
+#include <GL/GL/CommandList.hpp>
+#include <vector>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
+{
+	void Context::Enable( Capability::capability_t capability )
+	{
+		StateCache::SetCapability( capability, true );
+	}
+
+	void Context::Disable( Capability::capability_t capability )
+	{
+		StateCache::SetCapability( capability, false );
+	}
+
+	void Context::ClearColor( const Color& col )
+	{
+		glClearColor( col.R / 255.0f, col.G / 255.0f, col.B / 255.0f, col.A / 255.0f );
+	}
+
+	void Context::Clear( Buffer::buffer_t buffers )
+	{
+		glClear( buffers );
+	}
+
+	void Context::DepthMask( bool writeEnabled )
+	{
+		StateCache::DepthMask( writeEnabled );
+	}
+
+	void Context::StencilMask( bool writeEnabled )
+	{
+		StateCache::StencilMask( writeEnabled ? ~0 : 0 );
+	}
+
+	void Context::StencilMask( uint mask )
+	{
+		StateCache::StencilMask( mask );
+	}
+
+	void Context::StencilFunc( TestFunction::test_function_t function, int reference, uint mask )
+	{
+		StateCache::StencilFunc( function, reference, mask );
+	}
+
+	void Context::StencilOp( StencilAction::stencil_action_t fail, StencilAction::stencil_action_t zfail, StencilAction::stencil_action_t pass )
+	{
+		StateCache::StencilOp( fail, zfail, pass );
+	}
+
+	void Context::SetPipelineState( const PipelineState& state )
+	{
+		StateCache::SetPipelineState( state );
+	}
+
+	void Context::UseProgram( const Program& program )
+	{
+		StateCache::UseProgram( program );
+	}
+
+	void Context::BindTexture( const Texture& texture, uchar unit )
+	{
+		StateCache::BindTexture( unit, texture );
+	}
+
+	void Context::BindFramebuffer( const Framebuffer& framebuffer )
+	{
+		StateCache::BindFramebuffer( framebuffer );
+		
+		// Set viewport to frame buffer size
+		StateCache::Viewport( 0, 0, framebuffer.GetWidth(), framebuffer.GetHeight() );
+	}
+
+	void Context::BindFramebuffer()
+	{
+		StateCache::BindFramebuffer( 0 );
+
+		// Set viewport to default frame buffer size
+		StateCache::Viewport( defaultViewport[0], defaultViewport[1], defaultViewport[2], defaultViewport[3] );
+	}
+
+	void Context::BeginTransformFeedback( Primitive::primitive_t mode )
+	{
+		glBeginTransformFeedback( mode );
+	}
+
+	void Context::EndTransformFeedback()
+	{
+		glEndTransformFeedback();
+	}
+
+	void Context::DrawArrays( const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices )
+	{
+		StateCache::BindVertexArray( vao );
+		glDrawArrays( mode, offset, vertices );
+	}
+
+	void Context::DrawElements( const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type )
+	{
+		StateCache::BindVertexArray( vao );
+		glDrawElements( mode, count, type, (const GLvoid*)offset );
+	}
+
+	void Context::DrawArraysInstanced( const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices, uint instances )
+	{
+		StateCache::BindVertexArray( vao );
+		glDrawArraysInstanced( mode, offset, vertices, instances );
+	}
+
+	void Context::DrawElementsInstanced( const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type, uint instances )
+	{
+		StateCache::BindVertexArray( vao );
+		glDrawElementsInstanced( mode, count, type, (const GLvoid*)offset, instances );
+	}
+
+	void Context::DrawElementsBaseVertex( const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type, int baseVertex )
+	{
+		StateCache::BindVertexArray( vao );
+		glDrawElementsBaseVertex( mode, count, type, (const GLvoid*)offset, baseVertex );
+	}
+
+	void Context::MultiDrawArraysIndirect( const VertexArray& vao, const DrawIndirectBuffer& commands, Primitive::primitive_t mode, uint count, intptr_t offset, uint stride )
+	{
+		MultiDrawIndirect( vao, commands, mode, 0, count, offset, stride );
+	}
+
+	void Context::MultiDrawElementsIndirect( const VertexArray& vao, const DrawIndirectBuffer& commands, Primitive::primitive_t mode, uint type, uint count, intptr_t offset, uint stride )
+	{
+		MultiDrawIndirect( vao, commands, mode, type, count, offset, stride );
+	}
+
+	void Context::MultiDrawIndirect( GLuint vao, GLuint commands, GLenum mode, GLenum type, uint count, intptr_t offset, uint stride )
+	{
+		StateCache::BindVertexArray( vao );
+
+		if ( HasFeature( Feature::MultiDrawIndirect ) ) {
+			StateCache::BindDrawIndirectBuffer( commands );
+			if ( type ) glMultiDrawElementsIndirect( mode, type, (const GLvoid*)offset, count, stride );
+			else glMultiDrawArraysIndirect( mode, (const GLvoid*)offset, count, stride );
+			return;
+		}
+
+		if ( stride == 0 ) stride = type ? sizeof( DrawElementsIndirectCommand ) : sizeof( DrawArraysIndirectCommand );
+
+		// OpenGL 4.0 can still source each draw from the buffer, one call at a time
+		if ( HasFeature( Feature::DrawIndirect ) ) {
+			StateCache::BindDrawIndirectBuffer( commands );
+			for ( uint i = 0; i < count; i++ )
+			{
+				if ( type ) glDrawElementsIndirect( mode, type, (const GLvoid*)( offset + i * stride ) );
+				else glDrawArraysIndirect( mode, (const GLvoid*)( offset + i * stride ) );
+			}
+			return;
+		}
+
+		// Before that the commands have to be read back and issued from the CPU, which waits for the GPU
+		// to finish writing them. Base instances aren't supported there and are ignored.
+		if ( count == 0 ) return;
+		std::vector<uchar> data( ( count - 1 ) * stride + ( type ? sizeof( DrawElementsIndirectCommand ) : sizeof( DrawArraysIndirectCommand ) ) );
+		glBindBuffer( GL_COPY_READ_BUFFER, commands );
+		glGetBufferSubData( GL_COPY_READ_BUFFER, offset, data.size(), &data[0] );
+
+		uint indexSize = type == GL_UNSIGNED_BYTE ? 1 : type == GL_UNSIGNED_SHORT ? 2 : 4;
+		for ( uint i = 0; i < count; i++ )
+		{
+			if ( type ) {
+				const DrawElementsIndirectCommand& command = *(const DrawElementsIndirectCommand*)&data[i * stride];
+				glDrawElementsInstancedBaseVertex( mode, command.count, type, (const GLvoid*)( (intptr_t)command.firstIndex * indexSize ), command.instanceCount, command.baseVertex );
+			} else {
+				const DrawArraysIndirectCommand& command = *(const DrawArraysIndirectCommand*)&data[i * stride];
+				glDrawArraysInstanced( mode, command.first, command.count, command.instanceCount );
+			}
+		}
+	}
+
+	void Context::Execute( const CommandList& list )
+	{
+		list.Replay( *this );
+	}
+
+	void Context::Execute( const CommandList* const* lists, uint count )
+	{
+		for ( uint i = 0; i < count; i++ )
+			lists[i]->Replay( *this );
+	}
+
+	float Context::Time()
+	{
+		return (float)GetTime();
+	}
+
+	double Context::GetTime()
+	{
+		return GetTimeNanoseconds() / 1e9;
+	}
+
+	int64_t Context::GetTimeNanoseconds()
+	{
+		return Now() - timeOffset;
+	}
+
+	void Context::SetMaxFramesInFlight( uint frames )
+	{
+		pacer.SetFramesInFlight( frames );
+	}
+
+	void Context::EndFrame()
+	{
+		if ( pacer.GetFramesInFlight() > 0 ) {
+			int64_t start = Now();
+			pacer.EndFrame();
+			frameStats.AddWait( Now() - start );
+		}
+
+		GC::EndFrame();
+		frameStats.Tick( Now() );
+	}
+
+	void Context::InvalidateState()
+	{
+		StateCache::Invalidate();
+	}
+
+	StateCache::Stats Context::GetStateStats()
+	{
+		return StateCache::GetStats();
+	}
+
+	void Context::ResetStateStats()
+	{
+		StateCache::ResetStats();
+	}
+
+	Context Context::UseExistingContext()
+	{
+		return Context();
+	}
 }
\ No newline at end of file
@@ -0,0 +1,237 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/Context.hpp>
+#include <GL/GL/Extensions.hpp>
+#include <dlfcn.h>
+#include <cstring>
+
+#ifdef OOGL_PLATFORM_LINUX
+
+/*
+	EGL entry points
+
+	libEGL is opened when the first headless context is created, so programs
+	that only use windows don't have to link against it.
+*/
+
+typedef void* EGLDisplay;
+typedef void* EGLContext;
+typedef void* EGLConfig;
+typedef void* EGLSurface;
+typedef int32_t EGLint;
+typedef unsigned int EGLBoolean;
+typedef unsigned int EGLenum;
+
+#define EGL_DEFAULT_DISPLAY ( (void*)0 )
+#define EGL_NO_CONTEXT ( (EGLContext)0 )
+#define EGL_NO_SURFACE ( (EGLSurface)0 )
+#define EGL_NONE 0x3038
+#define EGL_EXTENSIONS 0x3055
+#define EGL_SURFACE_TYPE 0x3033
+#define EGL_RENDERABLE_TYPE 0x3040
+#define EGL_OPENGL_BIT 0x0008
+#define EGL_OPENGL_API 0x30A2
+#define EGL_CONTEXT_MAJOR_VERSION_KHR 0x3098
+#define EGL_CONTEXT_MINOR_VERSION_KHR 0x30FB
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR 0x30FD
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR 0x00000001
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+
+typedef void* ( * EGLGETPROCADDRESS ) ( const char* name );
+typedef EGLDisplay ( * EGLGETDISPLAY ) ( void* nativeDisplay );
+typedef EGLDisplay ( * EGLGETPLATFORMDISPLAYEXT ) ( EGLenum platform, void* nativeDisplay, const EGLint* attribs );
+typedef EGLBoolean ( * EGLINITIALIZE ) ( EGLDisplay display, EGLint* major, EGLint* minor );
+typedef const char* ( * EGLQUERYSTRING ) ( EGLDisplay display, EGLint name );
+typedef EGLBoolean ( * EGLBINDAPI ) ( EGLenum api );
+typedef EGLBoolean ( * EGLCHOOSECONFIG ) ( EGLDisplay display, const EGLint* attribs, EGLConfig* configs, EGLint size, EGLint* count );
+typedef EGLContext ( * EGLCREATECONTEXT ) ( EGLDisplay display, EGLConfig config, EGLContext share, const EGLint* attribs );
+typedef EGLBoolean ( * EGLDESTROYCONTEXT ) ( EGLDisplay display, EGLContext context );
+typedef EGLBoolean ( * EGLMAKECURRENT ) ( EGLDisplay display, EGLSurface draw, EGLSurface read, EGLContext context );
+typedef EGLContext ( * EGLGETCURRENTCONTEXT ) ();
+
+namespace GL
+{
+	struct EGL
+	{
+		EGLGETPROCADDRESS GetProcAddress;
+		EGLGETDISPLAY GetDisplay;
+		EGLGETPLATFORMDISPLAYEXT GetPlatformDisplayEXT;
+		EGLINITIALIZE Initialize;
+		EGLQUERYSTRING QueryString;
+		EGLBINDAPI BindAPI;
+		EGLCHOOSECONFIG ChooseConfig;
+		EGLCREATECONTEXT CreateContext;
+		EGLDESTROYCONTEXT DestroyContext;
+		EGLMAKECURRENT MakeCurrent;
+		EGLGETCURRENTCONTEXT GetCurrentContext;
+	};
+
+	static const EGL* LoadEGL()
+	{
+		static EGL egl;
+		static bool loaded = false;
+		if ( loaded ) return egl.MakeCurrent ? &egl : 0;
+		loaded = true;
+
+		void* library = dlopen( "libEGL.so.1", RTLD_NOW | RTLD_GLOBAL );
+		if ( !library ) return 0;
+
+		egl.GetProcAddress = (EGLGETPROCADDRESS)dlsym( library, "eglGetProcAddress" );
+		egl.GetDisplay = (EGLGETDISPLAY)dlsym( library, "eglGetDisplay" );
+		egl.Initialize = (EGLINITIALIZE)dlsym( library, "eglInitialize" );
+		egl.QueryString = (EGLQUERYSTRING)dlsym( library, "eglQueryString" );
+		egl.BindAPI = (EGLBINDAPI)dlsym( library, "eglBindAPI" );
+		egl.ChooseConfig = (EGLCHOOSECONFIG)dlsym( library, "eglChooseConfig" );
+		egl.CreateContext = (EGLCREATECONTEXT)dlsym( library, "eglCreateContext" );
+		egl.DestroyContext = (EGLDESTROYCONTEXT)dlsym( library, "eglDestroyContext" );
+		egl.MakeCurrent = (EGLMAKECURRENT)dlsym( library, "eglMakeCurrent" );
+		egl.GetCurrentContext = (EGLGETCURRENTCONTEXT)dlsym( library, "eglGetCurrentContext" );
+		egl.GetPlatformDisplayEXT = egl.GetProcAddress ? (EGLGETPLATFORMDISPLAYEXT)egl.GetProcAddress( "eglGetPlatformDisplayEXT" ) : 0;
+
+		if ( !egl.GetDisplay || !egl.Initialize || !egl.QueryString || !egl.BindAPI || !egl.ChooseConfig ||
+			!egl.CreateContext || !egl.DestroyContext || !egl.MakeCurrent || !egl.GetCurrentContext ) {
+			egl.MakeCurrent = 0;
+			return 0;
+		}
+
+		return &egl;
+	}
+
+	static bool HasExtension( const char* extensions, const char* name )
+	{
+		if ( !extensions ) return false;
+
+		size_t length = strlen( name );
+		for ( const char* found = strstr( extensions, name ); found; found = strstr( found + length, name ) )
+			if ( ( found == extensions || found[-1] == ' ' ) && ( found[length] == ' ' || found[length] == 0 ) ) return true;
+
+		return false;
+	}
+
+	static EGLContext CreateEGLContext( const EGL* egl, EGLDisplay display, EGLContext share )
+	{
+		// No surface is ever made, so any config that can do desktop OpenGL will do
+		const EGLint configAttribs[] = {
+			EGL_SURFACE_TYPE, 0,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_NONE
+		};
+
+		EGLConfig config;
+		EGLint configCount;
+		if ( !egl->ChooseConfig( display, configAttribs, &config, 1, &configCount ) || configCount == 0 ) throw PixelFormatException();
+
+		// Create OpenGL 3.2 context
+		const EGLint attribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+			EGL_CONTEXT_MINOR_VERSION_KHR, 2,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+			EGL_NONE
+		};
+
+		EGLContext context = egl->CreateContext( display, config, share, attribs );
+		if ( !context ) throw VersionException();
+
+		return context;
+	}
+
+	Context* Context::CreateHeadless()
+	{
+		const EGL* egl = LoadEGL();
+		if ( !egl ) throw HeadlessException();
+
+		// Mesa's surfaceless platform needs neither an X server nor a GPU, llvmpipe will do
+		EGLDisplay display = 0;
+		if ( egl->GetPlatformDisplayEXT && HasExtension( egl->QueryString( 0, EGL_EXTENSIONS ), "EGL_MESA_platform_surfaceless" ) )
+			display = egl->GetPlatformDisplayEXT( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, 0 );
+		if ( !display || !egl->Initialize( display, 0, 0 ) ) {
+			display = egl->GetDisplay( EGL_DEFAULT_DISPLAY );
+			if ( !display || !egl->Initialize( display, 0, 0 ) ) throw HeadlessException();
+		}
+
+		if ( !HasExtension( egl->QueryString( display, EGL_EXTENSIONS ), "EGL_KHR_surfaceless_context" ) ) throw HeadlessException();
+		if ( !egl->BindAPI( EGL_OPENGL_API ) ) throw VersionException();
+
+		EGLContext context = CreateEGLContext( egl, display, EGL_NO_CONTEXT );
+		egl->MakeCurrent( display, EGL_NO_SURFACE, EGL_NO_SURFACE, context );
+
+		// Extensions are loaded and the viewport read with the new context current
+		Context* headless = new Context();
+		headless->owned = true;
+		headless->eglDisplay = display;
+		headless->eglContext = context;
+		headless->context = 0;
+		headless->display = 0;
+		headless->window = 0;
+
+		return headless;
+	}
+
+	Context* Context::CreateSharedHeadless()
+	{
+		const EGL* egl = LoadEGL();
+
+		egl->BindAPI( EGL_OPENGL_API );
+		EGLContext worker = CreateEGLContext( egl, eglDisplay, eglContext );
+
+		Context* shared = new Context();
+		shared->owned = true;
+		shared->eglDisplay = eglDisplay;
+		shared->eglContext = worker;
+		shared->context = 0;
+		shared->display = 0;
+		shared->window = 0;
+		shared->timeOffset = timeOffset;
+		shared->shared = true;
+
+		return shared;
+	}
+
+	void Context::ActivateHeadless()
+	{
+		const EGL* egl = LoadEGL();
+		if ( egl->GetCurrentContext() == eglContext ) return;
+
+		// The cached state belongs to whichever context was current before
+		StateCache::Invalidate();
+
+		egl->MakeCurrent( eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, eglContext );
+		GC::SetSharedContextCurrent( shared );
+	}
+
+	void Context::DestroyHeadless()
+	{
+		const EGL* egl = LoadEGL();
+
+		// The display stays initialized, other headless contexts may still be using it
+		if ( egl->GetCurrentContext() == eglContext ) {
+			// The queued names of container objects belong to the main context
+			if ( !shared ) GC::FlushAll();
+			pacer.Reset();
+			egl->MakeCurrent( eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+			GC::SetSharedContextCurrent( false );
+		}
+		egl->DestroyContext( eglDisplay, eglContext );
+	}
+}
+
+#endif
@@ -8,8 +8,13 @@
 
 namespace GL
 {
+	int64_t Context::Now()
+	{
+		uint64_t time = SDL_GetPerformanceCounter();
+		uint64_t freq = SDL_GetPerformanceFrequency();
 
-	
+		return (int64_t)( time / freq * 1000000000 + time % freq * 1000000000 / freq );
+	}
 }
 
 #endif
\ No newline at end of file
@@ -96,21 +96,26 @@ namespace GL
 		this->owned = true;
 
 		glGetIntegerv( GL_VIEWPORT, (GLint*)&defaultViewport );
-
-		QueryPerformanceCounter( &timeOffset );
 	}
 	
 	Context::~Context()
 	{
 		if ( !owned ) return;
 
+		if ( wglGetCurrentContext() == context ) {
+			GC::FlushAll();
+			pacer.Reset();
+		}
 		wglMakeCurrent( dc, NULL );
 		wglDeleteContext( context );
 	}
 
 	void Context::Activate()
 	{
-		if ( owned && wglGetCurrentContext() != context ) wglMakeCurrent( dc, context );
+		if ( owned && wglGetCurrentContext() != context ) {
+			wglMakeCurrent( dc, context );
+			StateCache::Invalidate();
+		}
 	}
 
 	void Context::SetVerticalSync( bool enabled )
@@ -118,13 +123,14 @@ namespace GL
 		wglSwapIntervalEXT( enabled ? 1 : 0 );
 	}
 
-	float Context::Time()
+	int64_t Context::Now()
 	{
 		LARGE_INTEGER time, freq;
 		QueryPerformanceCounter( &time );
 		QueryPerformanceFrequency( &freq );
 
-		return ( ( time.QuadPart - timeOffset.QuadPart ) * 1000 / freq.QuadPart ) / 1000.0f;
+		// Split up so the multiplication can't overflow
+		return time.QuadPart / freq.QuadPart * 1000000000 + time.QuadPart % freq.QuadPart * 1000000000 / freq.QuadPart;
 	}
 
 	Context::Context()
@@ -134,8 +140,6 @@ namespace GL
 		owned = false;
 
 		glGetIntegerv( GL_VIEWPORT, (GLint*)&defaultViewport );
-
-		QueryPerformanceCounter( &timeOffset );
 	}
 }
 
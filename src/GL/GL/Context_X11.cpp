@@ -21,6 +21,7 @@
 
 #include <GL/GL/Context.hpp>
 #include <GL/GL/Extensions.hpp>
+#include <time.h>
 
 #ifdef OOGL_PLATFORM_LINUX
 
@@ -58,7 +59,7 @@ namespace GL
 		int configCount;
 		GLXFBConfig* configs = glXChooseFBConfig( display, screen, pixelAttribs, &configCount );
 		if ( configCount == 0 ) throw PixelFormatException();
-		GLXFBConfig config = configs[0];
+		config = configs[0];
 		XFree( configs );
 
 		// Create OpenGL 3.2 context
@@ -80,36 +81,97 @@ namespace GL
 		this->display = display;
 		this->window = window;
 		this->owned = true;
+		this->eglDisplay = 0;
+		this->eglContext = 0;
 
 		glGetIntegerv( GL_VIEWPORT, (GLint*)&defaultViewport );
-
-		gettimeofday( &timeOffset, NULL );
 	}
 
 	Context::~Context()
 	{
 		if ( !owned ) return;
-
-		glXMakeCurrent( display, 0, NULL );
+		if ( eglContext ) {
+			DestroyHeadless();
+			return;
+		}
+
+		if ( glXGetCurrentContext() == context ) {
+			// The queued names of container objects belong to the main context
+			if ( !shared ) GC::FlushAll();
+			pacer.Reset();
+			glXMakeCurrent( display, 0, NULL );
+			GC::SetSharedContextCurrent( false );
+		}
 		glXDestroyContext( display, context );
 	}
 
+	Context* Context::CreateSharedContext()
+	{
+		if ( !owned ) throw VersionException();
+		if ( eglContext ) return CreateSharedHeadless();
+
+		int attribs[] = {
+			GLX_CONTEXT_MAJOR_VERSION_ARB, 3,
+			GLX_CONTEXT_MINOR_VERSION_ARB, 2,
+			GLX_CONTEXT_PROFILE_MASK_ARB, GLX_CONTEXT_CORE_PROFILE_BIT_ARB,
+			0
+		};
+
+		// Shares buffers, textures, shaders and programs with this context, but
+		// not container objects like vertex arrays and framebuffers
+		GLXContext worker;
+		XERRORHANDLER oldHandler = XSetErrorHandler( &XErrorSurpressor );
+			worker = glXCreateContextAttribsARB( display, config, context, GL_TRUE, attribs );
+		XSetErrorHandler( oldHandler );
+		if ( !worker ) throw VersionException();
+
+		// The worker has no drawable of its own; 3.x contexts may be made
+		// current without one
+		Context* shared = new Context();
+		shared->owned = true;
+		shared->context = worker;
+		shared->config = config;
+		shared->display = display;
+		shared->window = 0;
+		shared->timeOffset = timeOffset;
+		shared->shared = true;
+
+		return shared;
+	}
+
 	void Context::Activate()
 	{
-		if ( owned && glXGetCurrentContext() != context ) glXMakeCurrent( display, window, context );
+		if ( eglContext ) {
+			ActivateHeadless();
+			return;
+		}
+		if ( !owned || glXGetCurrentContext() == context ) return;
+
+		// The cached state belongs to whichever context was current before
+		StateCache::Invalidate();
+
+		if ( window )
+			glXMakeCurrent( display, window, context );
+		else
+			glXMakeContextCurrent( display, None, None, context );
+		GC::SetSharedContextCurrent( shared );
 	}
 
 	void Context::SetVerticalSync( bool enabled )
 	{
+		// Nothing is ever presented without a window
+		if ( eglContext ) return;
+
 		glXSwapIntervalSGI( enabled ? 1 : 0 );
 	}
 
-	float Context::Time()
+	int64_t Context::Now()
 	{
-		timeval time;
-		gettimeofday( &time, NULL );
+		// Unlike gettimeofday, not moved by wall clock adjustments
+		timespec time;
+		clock_gettime( CLOCK_MONOTONIC, &time );
 
-		return time.tv_sec - timeOffset.tv_sec + ( time.tv_usec - timeOffset.tv_usec ) / 1000000.0f;
+		return (int64_t)time.tv_sec * 1000000000 + time.tv_nsec;
 	}
 
 	Context::Context()
@@ -117,10 +179,9 @@ namespace GL
 		// Prepare class for using unowned context (i.e. created by external party)
 		LoadExtensions();
 		owned = false;
+		eglDisplay = eglContext = 0;
 
 		glGetIntegerv( GL_VIEWPORT, (GLint*)&defaultViewport );
-
-		gettimeofday( &timeOffset, NULL );
 	}
 }
 
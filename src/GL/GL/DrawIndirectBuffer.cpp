@@ -0,0 +1,79 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/DrawIndirectBuffer.hpp>
+#include <assert.h>
+
+namespace GL
+{
+	DrawIndirectBuffer::DrawIndirectBuffer()
+		: capacity( 0 ), commandSize( 0 )
+	{
+	}
+
+	DrawIndirectBuffer DrawIndirectBuffer::ForArrays( uint commands, BufferUsage::buffer_usage_t usage )
+	{
+		DrawIndirectBuffer buffer;
+		buffer.ReserveArrays( commands, usage );
+		return buffer;
+	}
+
+	DrawIndirectBuffer DrawIndirectBuffer::ForElements( uint commands, BufferUsage::buffer_usage_t usage )
+	{
+		DrawIndirectBuffer buffer;
+		buffer.ReserveElements( commands, usage );
+		return buffer;
+	}
+
+	void DrawIndirectBuffer::ReserveArrays( uint commands, BufferUsage::buffer_usage_t usage )
+	{
+		Reserve( commands, sizeof( DrawArraysIndirectCommand ), usage );
+	}
+
+	void DrawIndirectBuffer::ReserveElements( uint commands, BufferUsage::buffer_usage_t usage )
+	{
+		Reserve( commands, sizeof( DrawElementsIndirectCommand ), usage );
+	}
+
+	void DrawIndirectBuffer::Reserve( uint commands, size_t commandSize, BufferUsage::buffer_usage_t usage )
+	{
+		capacity = commands;
+		this->commandSize = commandSize;
+		Data( 0, commands * commandSize, usage );
+	}
+
+	DrawArraysIndirectCommand* DrawIndirectBuffer::MapArrays()
+	{
+		assert( commandSize == sizeof( DrawArraysIndirectCommand ) );
+		return (DrawArraysIndirectCommand*)MapRange( 0, capacity * commandSize, MapAccess::Write | MapAccess::InvalidateBuffer );
+	}
+
+	DrawElementsIndirectCommand* DrawIndirectBuffer::MapElements()
+	{
+		assert( commandSize == sizeof( DrawElementsIndirectCommand ) );
+		return (DrawElementsIndirectCommand*)MapRange( 0, capacity * commandSize, MapAccess::Write | MapAccess::InvalidateBuffer );
+	}
+
+	void DrawIndirectBuffer::BindStorage( uint index )
+	{
+		glBindBufferBase( GL_SHADER_STORAGE_BUFFER, index, m_ID );
+	}
+}
@@ -30,6 +30,8 @@
 	GLXSWAPINTERVALSGI glXSwapIntervalSGI;
 #endif
 
+GLGETSTRINGI glGetStringi;
+
 GLCOMPILESHADER glCompileShader;
 GLCREATESHADER glCreateShader;
 GLDELETESHADER glDeleteShader;
@@ -87,6 +89,12 @@ GLBINDBUFFER glBindBuffer;
 GLBUFFERDATA glBufferData;
 GLBUFFERSUBDATA glBufferSubData;
 GLGETBUFFERSUBDATA glGetBufferSubData;
+GLGETBUFFERPARAMETERIV glGetBufferParameteriv;
+GLMAPBUFFERRANGE glMapBufferRange;
+GLUNMAPBUFFER glUnmapBuffer;
+GLFLUSHMAPPEDBUFFERRANGE glFlushMappedBufferRange;
+GLCOPYBUFFERSUBDATA glCopyBufferSubData;
+GLBUFFERSTORAGE glBufferStorage;
 
 GLGENVERTEXARRAYS glGenVertexArrays;
 GLDELETEVERTEXARRAYS glDeleteVertexArrays;
@@ -94,6 +102,12 @@ GLBINDVERTEXARRAY glBindVertexArray;
 
 GLENABLEVERTEXATTRIBARRAY glEnableVertexAttribArray;
 GLVERTEXATTRIBPOINTER glVertexAttribPointer;
+GLVERTEXATTRIBDIVISOR glVertexAttribDivisor;
+
+GLDRAWARRAYSINSTANCED glDrawArraysInstanced;
+GLDRAWELEMENTSINSTANCED glDrawElementsInstanced;
+GLDRAWELEMENTSBASEVERTEX glDrawElementsBaseVertex;
+GLDRAWELEMENTSINSTANCEDBASEVERTEX glDrawElementsInstancedBaseVertex;
 
 GLGENERATEMIPMAP glGenerateMipmap;
 
@@ -101,6 +115,10 @@ GLGENERATEMIPMAP glGenerateMipmap;
 	GLACTIVETEXTURE glActiveTexture;
 #endif
 
+#ifndef GL_ARB_imaging
+	GLBLENDEQUATION glBlendEquation;
+#endif
+
 GLGENFRAMEBUFFERS glGenFramebuffers;
 GLDELETEFRAMEBUFFERS glDeleteFramebuffers;
 GLFRAMEBUFFERTEXTURE2D glFramebufferTexture2D;
@@ -119,6 +137,32 @@ GLBINDBUFFERBASE glBindBufferBase;
 GLBEGINTRANSFORMFEEDBACK glBeginTransformFeedback;
 GLENDTRANSFORMFEEDBACK glEndTransformFeedback;
 
+GLFENCESYNC glFenceSync;
+GLDELETESYNC glDeleteSync;
+GLCLIENTWAITSYNC glClientWaitSync;
+GLWAITSYNC glWaitSync;
+
+GLGENQUERIES glGenQueries;
+GLDELETEQUERIES glDeleteQueries;
+GLBEGINQUERY glBeginQuery;
+GLENDQUERY glEndQuery;
+GLQUERYCOUNTER glQueryCounter;
+GLGETQUERYOBJECTIV glGetQueryObjectiv;
+GLGETQUERYOBJECTUI64V glGetQueryObjectui64v;
+
+GLDRAWARRAYSINDIRECT glDrawArraysIndirect;
+GLDRAWELEMENTSINDIRECT glDrawElementsIndirect;
+GLMULTIDRAWARRAYSINDIRECT glMultiDrawArraysIndirect;
+GLMULTIDRAWELEMENTSINDIRECT glMultiDrawElementsIndirect;
+
+GLCREATETEXTURES glCreateTextures;
+GLTEXTUREPARAMETERI glTextureParameteri;
+GLTEXTUREPARAMETERFV glTextureParameterfv;
+GLGENERATETEXTUREMIPMAP glGenerateTextureMipmap;
+GLCREATEFRAMEBUFFERS glCreateFramebuffers;
+GLNAMEDFRAMEBUFFERTEXTURE glNamedFramebufferTexture;
+GLCHECKNAMEDFRAMEBUFFERSTATUS glCheckNamedFramebufferStatus;
+
 namespace GL
 {
 	bool extensionsLoaded = false;
@@ -146,6 +190,8 @@ namespace GL
 		glXSwapIntervalSGI = (GLXSWAPINTERVALSGI)LoadExtension( "glXSwapIntervalSGI" );
 #endif
 
+		glGetStringi = (GLGETSTRINGI)LoadExtension( "glGetStringi" );
+
 		glCompileShader = (GLCOMPILESHADER)LoadExtension( "glCompileShader" );
 		glCreateShader = (GLCREATESHADER)LoadExtension( "glCreateShader" );
 		glDeleteShader = (GLDELETESHADER)LoadExtension( "glDeleteShader" );
@@ -203,6 +249,12 @@ namespace GL
 		glBufferData = (GLBUFFERDATA)LoadExtension( "glBufferData" );
 		glBufferSubData = (GLBUFFERSUBDATA)LoadExtension( "glBufferSubData" );
 		glGetBufferSubData = (GLGETBUFFERSUBDATA)LoadExtension( "glGetBufferSubData" );
+		glGetBufferParameteriv = (GLGETBUFFERPARAMETERIV)LoadExtension( "glGetBufferParameteriv" );
+		glMapBufferRange = (GLMAPBUFFERRANGE)LoadExtension( "glMapBufferRange" );
+		glUnmapBuffer = (GLUNMAPBUFFER)LoadExtension( "glUnmapBuffer" );
+		glFlushMappedBufferRange = (GLFLUSHMAPPEDBUFFERRANGE)LoadExtension( "glFlushMappedBufferRange" );
+		glCopyBufferSubData = (GLCOPYBUFFERSUBDATA)LoadExtension( "glCopyBufferSubData" );
+		glBufferStorage = (GLBUFFERSTORAGE)LoadExtension( "glBufferStorage" );
 
 		glGenVertexArrays = (GLGENVERTEXARRAYS)LoadExtension( "glGenVertexArrays" );
 		glDeleteVertexArrays = (GLDELETEVERTEXARRAYS)LoadExtension( "glDeleteVertexArrays" );
@@ -210,6 +262,12 @@ namespace GL
 
 		glEnableVertexAttribArray = (GLENABLEVERTEXATTRIBARRAY)LoadExtension( "glEnableVertexAttribArray" );
 		glVertexAttribPointer = (GLVERTEXATTRIBPOINTER)LoadExtension( "glVertexAttribPointer" );
+		glVertexAttribDivisor = (GLVERTEXATTRIBDIVISOR)LoadExtension( "glVertexAttribDivisor" );
+
+		glDrawArraysInstanced = (GLDRAWARRAYSINSTANCED)LoadExtension( "glDrawArraysInstanced" );
+		glDrawElementsInstanced = (GLDRAWELEMENTSINSTANCED)LoadExtension( "glDrawElementsInstanced" );
+		glDrawElementsBaseVertex = (GLDRAWELEMENTSBASEVERTEX)LoadExtension( "glDrawElementsBaseVertex" );
+		glDrawElementsInstancedBaseVertex = (GLDRAWELEMENTSINSTANCEDBASEVERTEX)LoadExtension( "glDrawElementsInstancedBaseVertex" );
 
 		glGenerateMipmap = (GLGENERATEMIPMAP)LoadExtension( "glGenerateMipmap" );
 
@@ -217,6 +275,10 @@ namespace GL
 			glActiveTexture = (GLACTIVETEXTURE)LoadExtension( "glActiveTexture" );
 		#endif
 
+		#ifndef GL_ARB_imaging
+			glBlendEquation = (GLBLENDEQUATION)LoadExtension( "glBlendEquation" );
+		#endif
+
 		glGenFramebuffers = (GLGENFRAMEBUFFERS)LoadExtension( "glGenFramebuffers" );
 		glDeleteFramebuffers = (GLDELETEFRAMEBUFFERS)LoadExtension( "glDeleteFramebuffers" );
 		glFramebufferTexture2D = (GLFRAMEBUFFERTEXTURE2D)LoadExtension( "glFramebufferTexture2D" );
@@ -234,5 +296,32 @@ namespace GL
 		glBindBufferBase = (GLBINDBUFFERBASE)LoadExtension( "glBindBufferBase" );
 		glBeginTransformFeedback = (GLBEGINTRANSFORMFEEDBACK)LoadExtension( "glBeginTransformFeedback" );
 		glEndTransformFeedback = (GLENDTRANSFORMFEEDBACK)LoadExtension( "glEndTransformFeedback" );
+
+		glFenceSync = (GLFENCESYNC)LoadExtension( "glFenceSync" );
+		glDeleteSync = (GLDELETESYNC)LoadExtension( "glDeleteSync" );
+		glClientWaitSync = (GLCLIENTWAITSYNC)LoadExtension( "glClientWaitSync" );
+		glWaitSync = (GLWAITSYNC)LoadExtension( "glWaitSync" );
+
+		glGenQueries = (GLGENQUERIES)LoadExtension( "glGenQueries" );
+		glDeleteQueries = (GLDELETEQUERIES)LoadExtension( "glDeleteQueries" );
+		glBeginQuery = (GLBEGINQUERY)LoadExtension( "glBeginQuery" );
+		glEndQuery = (GLENDQUERY)LoadExtension( "glEndQuery" );
+		glQueryCounter = (GLQUERYCOUNTER)LoadExtension( "glQueryCounter" );
+		glGetQueryObjectiv = (GLGETQUERYOBJECTIV)LoadExtension( "glGetQueryObjectiv" );
+		glGetQueryObjectui64v = (GLGETQUERYOBJECTUI64V)LoadExtension( "glGetQueryObjectui64v" );
+
+		glDrawArraysIndirect = (GLDRAWARRAYSINDIRECT)LoadExtension( "glDrawArraysIndirect" );
+		glDrawElementsIndirect = (GLDRAWELEMENTSINDIRECT)LoadExtension( "glDrawElementsIndirect" );
+		glMultiDrawArraysIndirect = (GLMULTIDRAWARRAYSINDIRECT)LoadExtension( "glMultiDrawArraysIndirect" );
+		glMultiDrawElementsIndirect = (GLMULTIDRAWELEMENTSINDIRECT)LoadExtension( "glMultiDrawElementsIndirect" );
+
+		// Only present from OpenGL 4.5 or with ARB_direct_state_access, see HasFeature
+		glCreateTextures = (GLCREATETEXTURES)LoadExtension( "glCreateTextures" );
+		glTextureParameteri = (GLTEXTUREPARAMETERI)LoadExtension( "glTextureParameteri" );
+		glTextureParameterfv = (GLTEXTUREPARAMETERFV)LoadExtension( "glTextureParameterfv" );
+		glGenerateTextureMipmap = (GLGENERATETEXTUREMIPMAP)LoadExtension( "glGenerateTextureMipmap" );
+		glCreateFramebuffers = (GLCREATEFRAMEBUFFERS)LoadExtension( "glCreateFramebuffers" );
+		glNamedFramebufferTexture = (GLNAMEDFRAMEBUFFERTEXTURE)LoadExtension( "glNamedFramebufferTexture" );
+		glCheckNamedFramebufferStatus = (GLCHECKNAMEDFRAMEBUFFERSTATUS)LoadExtension( "glCheckNamedFramebufferStatus" );
 	}
 }
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/Features.hpp>
+#include <atomic>
+#include <cstring>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
+{
+	struct FeatureInfo
+	{
+		const char* extension;
+		int coreVersion;
+	};
+
+	static const FeatureInfo features[] = {
+		{ "GL_ARB_direct_state_access", 45 },
+		{ "GL_ARB_multi_draw_indirect", 43 },
+		{ "GL_ARB_timer_query", 33 },
+		{ "GL_ARB_buffer_storage", 44 },
+		{ "GL_ARB_draw_indirect", 40 }
+	};
+
+	static const uint featureCount = sizeof( features ) / sizeof( features[0] );
+
+	enum { Undetected, Unsupported, Supported };
+	static std::atomic<int> supported[featureCount];
+
+	static bool Detect( Feature::feature_t feature )
+	{
+#if defined(__GLEW_H__)
+		switch ( feature )
+		{
+			case Feature::DirectStateAccess: return GLEW_ARB_direct_state_access != 0;
+			case Feature::MultiDrawIndirect: return GLEW_ARB_multi_draw_indirect != 0;
+			case Feature::TimerQuery: return GLEW_ARB_timer_query != 0;
+			case Feature::BufferStorage: return GLEW_ARB_buffer_storage != 0;
+			case Feature::DrawIndirect: return GLEW_ARB_draw_indirect != 0;
+		}
+		return false;
+#else
+		GLint major = 0, minor = 0;
+		glGetIntegerv( GL_MAJOR_VERSION, &major );
+		glGetIntegerv( GL_MINOR_VERSION, &minor );
+		if ( major * 10 + minor >= features[feature].coreVersion ) return true;
+
+		GLint count = 0;
+		glGetIntegerv( GL_NUM_EXTENSIONS, &count );
+		for ( GLint i = 0; i < count; i++ )
+		{
+			const char* name = (const char*)glGetStringi( GL_EXTENSIONS, i );
+			if ( name && strcmp( name, features[feature].extension ) == 0 ) return true;
+		}
+		return false;
+#endif
+	}
+
+	bool HasFeature( Feature::feature_t feature )
+	{
+		int state = supported[feature].load( std::memory_order_relaxed );
+		if ( state == Undetected ) {
+			state = Detect( feature ) ? Supported : Unsupported;
+			supported[feature] = state;
+		}
+		return state == Supported;
+	}
+
+	void DisableFeature( Feature::feature_t feature )
+	{
+		supported[feature] = Unsupported;
+	}
+}
@@ -0,0 +1,133 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/Fence.hpp>
+
+namespace GL
+{
+	Fence::Fence()
+		: sync( 0 )
+	{
+	}
+
+	Fence::Fence( Fence&& other ) noexcept
+		: sync( other.sync )
+	{
+		other.sync = 0;
+	}
+
+	Fence::~Fence()
+	{
+		Reset();
+	}
+
+	const Fence& Fence::operator=( Fence&& other ) noexcept
+	{
+		if ( this != &other ) {
+			Reset();
+			sync = other.sync;
+			other.sync = 0;
+		}
+		return *this;
+	}
+
+	void Fence::Insert()
+	{
+		Reset();
+		sync = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+	}
+
+	void Fence::Reset()
+	{
+		if ( sync ) glDeleteSync( sync );
+		sync = 0;
+	}
+
+	bool Fence::IsSignaled() const
+	{
+		if ( !sync ) return true;
+
+		GLenum status = glClientWaitSync( sync, 0, 0 );
+		return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+	}
+
+	bool Fence::Wait( uint64_t timeoutNanoseconds ) const
+	{
+		if ( !sync ) return true;
+
+		// The flush makes sure the fence reaches the GPU, or the wait could never end
+		GLenum status = glClientWaitSync( sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNanoseconds );
+		return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+	}
+
+	void Fence::WaitOnServer() const
+	{
+		if ( sync ) glWaitSync( sync, 0, GL_TIMEOUT_IGNORED );
+	}
+
+	FramePacer::FramePacer( uint framesInFlight )
+		: first( 0 ), count( 0 ), framesInFlight( framesInFlight < MaxFramesInFlight ? framesInFlight : MaxFramesInFlight )
+	{
+	}
+
+	FramePacer::FramePacer( const FramePacer& other )
+		: first( 0 ), count( 0 ), framesInFlight( other.framesInFlight )
+	{
+	}
+
+	const FramePacer& FramePacer::operator=( const FramePacer& other )
+	{
+		if ( this != &other ) {
+			Reset();
+			framesInFlight = other.framesInFlight;
+		}
+		return *this;
+	}
+
+	void FramePacer::SetFramesInFlight( uint frames )
+	{
+		framesInFlight = frames < MaxFramesInFlight ? frames : MaxFramesInFlight;
+		if ( framesInFlight == 0 ) Reset();
+	}
+
+	void FramePacer::EndFrame()
+	{
+		if ( framesInFlight == 0 ) return;
+
+		fences[( first + count ) % Slots].Insert();
+		count++;
+
+		// A lowered limit is caught up with here, by waiting for more than one frame
+		while ( count > framesInFlight )
+		{
+			fences[first].Wait();
+			fences[first].Reset();
+			first = ( first + 1 ) % Slots;
+			count--;
+		}
+	}
+
+	void FramePacer::Reset()
+	{
+		for ( uint i = 0; i < Slots; i++ ) fences[i].Reset();
+		first = count = 0;
+	}
+}
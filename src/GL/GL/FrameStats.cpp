@@ -0,0 +1,137 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/FrameStats.hpp>
+#include <algorithm>
+
+namespace GL
+{
+	// Weight of the newest frame in the running average
+	static const double AverageWeight = 0.05;
+
+	FrameStats::FrameStats( uint history )
+		: frames( history > 0 ? history : 1 ), waits( frames.size() ), hitchFactor( 2.0 )
+	{
+		sorted.reserve( frames.size() );
+		Reset();
+	}
+
+	void FrameStats::Tick( int64_t nanoseconds )
+	{
+		if ( lastTick >= 0 ) AddFrame( nanoseconds - lastTick );
+		else pendingWait = 0;
+		lastTick = nanoseconds;
+	}
+
+	void FrameStats::AddFrame( int64_t nanoseconds )
+	{
+		// Compared to the average before this frame, so a hitch doesn't hide itself
+		if ( count > 0 && nanoseconds > average * hitchFactor ) hitches++;
+		average = count > 0 ? average + ( nanoseconds - average ) * AverageWeight : (double)nanoseconds;
+
+		frames[next] = nanoseconds;
+		waits[next] = pendingWait;
+		pendingWait = 0;
+		next = ( next + 1 ) % frames.size();
+		if ( count < frames.size() ) count++;
+	}
+
+	double FrameStats::GetFrameTime( uint framesAgo ) const
+	{
+		if ( framesAgo >= count ) return 0.0;
+
+		size_t index = ( next + frames.size() - 1 - framesAgo ) % frames.size();
+		return frames[index] / 1e9;
+	}
+
+	void FrameStats::AddWait( int64_t nanoseconds )
+	{
+		pendingWait += nanoseconds;
+	}
+
+	double FrameStats::GetWaitTime( uint framesAgo ) const
+	{
+		if ( framesAgo >= count ) return 0.0;
+
+		size_t index = ( next + waits.size() - 1 - framesAgo ) % waits.size();
+		return waits[index] / 1e9;
+	}
+
+	double FrameStats::GetPercentile( double percentile ) const
+	{
+		if ( count == 0 ) return 0.0;
+
+		sorted.assign( frames.begin(), frames.begin() + count );
+		std::sort( sorted.begin(), sorted.end() );
+
+		return Percentile( percentile );
+	}
+
+	FrameStats::Summary FrameStats::GetSummary() const
+	{
+		Summary summary = Summary();
+		summary.frames = count;
+		summary.hitches = hitches;
+		if ( count == 0 ) return summary;
+
+		sorted.assign( frames.begin(), frames.begin() + count );
+		std::sort( sorted.begin(), sorted.end() );
+
+		int64_t total = 0;
+		for ( uint i = 0; i < count; i++ ) total += sorted[i];
+
+		summary.average = total / 1e9 / count;
+		summary.p50 = Percentile( 50.0 );
+		summary.p95 = Percentile( 95.0 );
+		summary.p99 = Percentile( 99.0 );
+		summary.max = sorted[count - 1] / 1e9;
+
+		int64_t waitTotal = 0, waitMax = 0;
+		for ( uint i = 0; i < count; i++ ) {
+			waitTotal += waits[i];
+			if ( waits[i] > waitMax ) waitMax = waits[i];
+		}
+
+		summary.waitAverage = waitTotal / 1e9 / count;
+		summary.waitMax = waitMax / 1e9;
+
+		return summary;
+	}
+
+	void FrameStats::Reset()
+	{
+		next = count = 0;
+		lastTick = -1;
+		pendingWait = 0;
+		average = 0.0;
+		hitches = 0;
+	}
+
+	// Nearest rank over the sorted history
+	double FrameStats::Percentile( double percentile ) const
+	{
+		double rank = percentile / 100.0 * count;
+		uint index = rank <= 1.0 ? 0 : (uint)( rank + 0.999999 ) - 1;
+		if ( index >= count ) index = count - 1;
+
+		return sorted[index] / 1e9;
+	}
+}
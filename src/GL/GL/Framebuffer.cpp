@@ -20,84 +20,59 @@
 */
 
 #include <GL/GL/Framebuffer.hpp>
-
-#define PUSHSTATE() GLint restoreId; glGetIntegerv( GL_DRAW_FRAMEBUFFER_BINDING, &restoreId );
-#define POPSTATE() glBindFramebuffer( GL_DRAW_FRAMEBUFFER, restoreId );
+#include <GL/GL/StateCache.hpp>
+#include <GL/GL/Features.hpp>
 
 namespace GL
 {
-	Framebuffer::Framebuffer( const Framebuffer& other )
+	static void AttachTexture( GLuint framebuffer, GLenum attachment, GLuint texture )
 	{
-		//gc.Copy( other.obj, obj );
-		gc.Copy(obj, other.obj);
-		texColor = other.texColor;
-		texDepth = other.texDepth;
+		if ( HasFeature( Feature::DirectStateAccess ) )
+			glNamedFramebufferTexture( framebuffer, attachment, texture, 0 );
+		else
+			glFramebufferTexture2D( GL_DRAW_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture, 0 );
 	}
 
 	Framebuffer::Framebuffer( uint width, uint height, uchar color, uchar depth )
+		: width( width ), height( height )
 	{
-		PUSHSTATE()
-
 		// Determine appropriate formats
-		InternalFormat::internal_format_t colorFormat;
 		if ( color == 24 ) colorFormat = InternalFormat::RGB;
 		else if ( color == 32 ) colorFormat = InternalFormat::RGBA;
 		else throw FramebufferException();
 
-		InternalFormat::internal_format_t depthFormat;
 		if ( depth == 8 ) depthFormat = InternalFormat::DepthComponent;
 		else if ( depth == 16 ) depthFormat = InternalFormat::DepthComponent16;
 		else if ( depth == 24 ) depthFormat = InternalFormat::DepthComponent24;
 		else if ( depth == 32 ) depthFormat = InternalFormat::DepthComponent32F;
 		else throw FramebufferException();
 
-		// Create FBO		
-		//gc.Create( obj, glGenFramebuffers, glDeleteFramebuffers );
-		obj = gc.Create(glGenFramebuffers);
-		glBindFramebuffer( GL_DRAW_FRAMEBUFFER, obj );
+		// Without direct state access the FBO has to be bound, the previous binding is taken from the state cache
+		bool dsa = HasFeature( Feature::DirectStateAccess );
+		GLuint restoreId = StateCache::GetFramebuffer();
+		if ( !dsa ) StateCache::BindFramebuffer( m_ID );
 
 		// Create texture to hold color buffer
 		texColor.Image2D( 0, DataType::UnsignedByte, Format::RGBA, width, height, colorFormat );
 		texColor.SetWrapping( GL::Wrapping::ClampEdge, GL::Wrapping::ClampEdge );
 		texColor.SetFilters( GL::Filter::Linear, GL::Filter::Linear );
-		glFramebufferTexture2D( GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texColor, 0 );
+		AttachTexture( m_ID, GL_COLOR_ATTACHMENT0, texColor );
 		
-		// Create renderbuffer to hold depth buffer
+		// Create texture to hold depth buffer
 		if ( depth > 0 ) {
-			glBindTexture( GL_TEXTURE_2D, texDepth );
-			glTexImage2D( GL_TEXTURE_2D, 0, depthFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_BYTE, 0 );
+			texDepth.Image2D( 0, DataType::UnsignedByte, Format::DepthComponent, width, height, depthFormat );
 			texDepth.SetWrapping( GL::Wrapping::ClampEdge, GL::Wrapping::ClampEdge );
 			texDepth.SetFilters( GL::Filter::Nearest, GL::Filter::Nearest );
-			glFramebufferTexture2D( GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texDepth, 0 );
+			AttachTexture( m_ID, GL_DEPTH_ATTACHMENT, texDepth );
 		}
 
 		// Check
-		if ( glCheckFramebufferStatus( GL_DRAW_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE )
-			throw FramebufferException();
-		
-		POPSTATE()
-	}
+		GLenum status = dsa ? glCheckNamedFramebufferStatus( m_ID, GL_DRAW_FRAMEBUFFER ) : glCheckFramebufferStatus( GL_DRAW_FRAMEBUFFER );
 
-	Framebuffer::~Framebuffer()
-	{
-		gc.Destroy(obj, glDeleteFramebuffers);
-		//gc.Destroy( obj );
-	}
+		if ( !dsa ) StateCache::BindFramebuffer( restoreId != StateCache::Unknown ? restoreId : 0 );
 
-	Framebuffer::operator GLuint() const
-	{
-		return obj;
-	}
-
-	const Framebuffer& Framebuffer::operator=( const Framebuffer& other )
-	{
-		//gc.Copy( other.obj, obj, true );
-		gc.Destroy(obj, glDeleteBuffers);
-		gc.Copy(obj, other.obj);
-		texColor = other.texColor;
-		texDepth = other.texDepth;
-		
-		return *this;
+		if ( status != GL_FRAMEBUFFER_COMPLETE )
+			throw FramebufferException();
 	}
 
 	const Texture& Framebuffer::GetTexture()
@@ -110,5 +85,4 @@ namespace GL
 		return texDepth;
 	}
 
-	GC Framebuffer::gc;
 }
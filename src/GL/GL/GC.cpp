@@ -1,84 +1,371 @@
 #include <GL/GL/GC.hpp>
+#include <GL/GL/Fence.hpp>
+#include <assert.h>
+#include <algorithm>
+#include <mutex>
+#include <atomic>
 
-#if defined(OOGL_PLATFORM_WINDOWS) || defined( OOGL_PLATFORM_LINUX ) 
-void GC::Create(GLuint& obj, createFunc c, deleteFunc d)
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
 {
-	c(1, &obj);
-	refs.insert(std::pair<GLuint, uint>(obj, 1));
+	// Every GC registers itself so EndFrame() and FlushAll() can reach the
+	// per-type collectors
+	static std::vector<GC*>& Collectors() {
+		static std::vector<GC*> collectors;
+		return collectors;
+	}
 
-	this->d = d;
-	this->d2 = 0;
-}
+	// Guards the collector list and the frame fences below
+	static std::mutex& CollectorsMutex() {
+		static std::mutex mutex;
+		return mutex;
+	}
 
-int GC::Create(const GLuint& obj, deleteFunc2 d2)
-{
-	refs.insert(std::pair<GLuint, uint>(obj, 1));
+	// Fences of frames that retired names, oldest first
+	struct FrameFence {
+		uint64_t frame;
+		Fence fence;
+	};
 
-	this->d = 0;
-	this->d2 = d2;
+	// Never destroyed, deleting the syncs during static destruction would
+	// happen without a context; FlushAll() drains it while one is current
+	static std::deque<FrameFence>& FrameFences() {
+		static std::deque<FrameFence>* fences = new std::deque<FrameFence>();
+		return *fences;
+	}
 
-	return obj;
-}
+	static uint64_t currentFrame = 1;
+	static bool frameFencing = false;
 
-void GC::Copy(const GLuint& from, GLuint& to, bool destructive = false)
-{
-	if (destructive)
-		Destroy(to);
+	// Bumped whenever names are deleted, so caches of bound names know to
+	// forget them
+	static std::atomic<uint> deleteEpoch(0);
 
-	to = from;
-	refs[from]++;
-}
+	// Whether the calling thread has a context from CreateSharedContext current
+	static thread_local bool sharedContextCurrent = false;
 
-void GC::Destroy(GLuint& obj)
-{
-	if (--refs[obj] == 0)
-	{
-		if (d != 0) d(1, &obj); else d2(obj);
-		refs.erase(obj);
+	GC::GC(GenerateFunc generateFunc, DeleteFunc deleteFunc, uint batchSize, MemoryCategory::memory_category_t category, bool perContext)
+		: generateFunc(generateFunc), deleteFunc(deleteFunc), batchSize(batchSize > 0 ? batchSize : 1), category(category), perContext(perContext), stats() {
+		std::lock_guard<std::mutex> lock(CollectorsMutex());
+		Collectors().push_back(this);
 	}
-}
 
-#elif defined(OOGL_PLATFORM_SDL)
+	GC::~GC() {
+		// Pooled and retired names are left to the context; there may be none
+		// current by the time static collectors are destroyed
+		std::lock_guard<std::mutex> lock(CollectorsMutex());
+		std::vector<GC*>& collectors = Collectors();
+		collectors.erase(std::remove(collectors.begin(), collectors.end(), this), collectors.end());
+	}
 
-using namespace GL;
-ID GC::Create(ID id) {
-	refs.insert(std::pair<ID, uint16_t>(id, 1));
-	return id;
-}
-ID GC::Create(function<ID()> generatorFunc) {
-	ID obj{ 0 };
-	obj = generatorFunc();
-	refs.insert(std::pair<ID, uint16_t>(obj, 1));
-	return obj;
-}
+	GC::Handle GC::Allocate(ID id) {
+		uint index;
 
-ID GC::Create(function<void(GLsizei, GL::ID*)> generatorFunc) {
-	ID obj = 0;
-	generatorFunc(1, &obj);
-	refs.insert(std::pair<ID, uint16_t>(obj, 1));
-	return obj;
-}
+		if (!freeSlots.empty()) {
+			index = freeSlots.back();
+			freeSlots.pop_back();
+		}
+		else {
+			index = (uint)refs.size();
+			assert(index <= IndexMask && "GC slot table exhausted");
 
-void GC::Copy(ID& dst, const ID& src) {
-	dst = src;
-	refs[dst]++;
-}
-void GC::Destroy(ID& obj, std::function<void(GLsizei, const ID*)> deleterFunc) {
-	if (--refs[obj] == 0) {
-		deleterFunc(1, &obj);
-		refs.erase(obj);
-		obj = 0;
+			refs.push_back(0);
+			ids.push_back(0);
+			generations.push_back(1);
+			footprints.push_back(0);
+			mipChains.push_back(0);
+		}
+
+		refs[index] = 1;
+		ids[index] = id;
+
+		return ((Handle)generations[index] << IndexBits) | index;
 	}
-}
 
-void GC::Destroy(ID& obj, std::function<void(GLuint)> deleterFunc) {
-	if (--refs[obj] == 0) {
-		deleterFunc(obj);
-		refs.erase(obj);
-		obj = 0;
+	bool GC::Valid(Handle handle) const {
+		uint index = handle & IndexMask;
+		if (handle == Null || index >= refs.size()) return false;
+
+		return generations[index] == (handle >> IndexBits) && refs[index] > 0;
 	}
-}
 
-#endif
+	size_t GC::Footprint(uint index) const {
+		// A full mip chain adds about a third on top of the base level
+		return mipChains[index] ? footprints[index] + footprints[index] / 3 : footprints[index];
+	}
+
+	ptrdiff_t GC::Account(uint index, size_t bytes, bool mipChain) {
+		size_t old = Footprint(index);
+
+		footprints[index] = bytes;
+		mipChains[index] = mipChain;
+
+		return (ptrdiff_t)Footprint(index) - (ptrdiff_t)old;
+	}
+
+	bool GC::Release(Handle& handle, ID& id) {
+		if (handle == Null) return false;
+
+		ptrdiff_t footprint;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
 
+			assert(Valid(handle) && "stale GC handle");
+			if (!Valid(handle)) {
+				handle = Null;
+				return false;
+			}
+
+			uint index = handle & IndexMask;
+			handle = Null;
+
+			if (--refs[index] > 0) return false;
+
+			id = ids[index];
+			ids[index] = 0;
+			footprint = Account(index, 0, false);
+
+			// Bump the generation so outstanding copies of the handle become stale,
+			// skipping zero to keep Null distinct from every live handle
+			generations[index] = (generations[index] + 1) & GenerationMask;
+			if (generations[index] == 0) generations[index] = 1;
+
+			freeSlots.push_back(index);
+		}
+
+		Memory::Track(category, footprint);
+		return true;
+	}
+
+	ID GC::Create(Handle& handle) {
+		assert(generateFunc && "GC has no generate entry point");
+		assert(!(perContext && sharedContextCurrent) && "Container objects can't be created on a shared context");
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (freeNames.empty()) {
+			freeNames.resize(batchSize);
+			generateFunc((GLsizei)batchSize, &freeNames[0]);
+
+			stats.namesGenerated += batchSize;
+			stats.generateCalls++;
+		}
+
+		ID id = freeNames.back();
+		freeNames.pop_back();
+
+		handle = Allocate(id);
+		return id;
+	}
+
+	ID GC::Create(Handle& handle, ID id) {
+		std::lock_guard<std::mutex> lock(mutex);
+
+		handle = Allocate(id);
+		return id;
+	}
+
+	void GC::Copy(Handle& dst, const Handle& src) {
+		dst = src;
+		if (src == Null) return;
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		assert(Valid(src) && "stale GC handle");
+		refs[src & IndexMask]++;
+	}
+
+	void GC::Delete(std::vector<ID>& names) {
+		if (names.empty()) return;
+
+		assert(deleteFunc && "GC has no delete entry point");
+		deleteFunc((GLsizei)names.size(), &names[0]);
+
+		stats.namesDeleted += (uint)names.size();
+		stats.deleteCalls++;
+		deleteEpoch++;
+
+		names.clear();
+	}
+
+	void GC::Retire(ID id) {
+		assert(!(perContext && sharedContextCurrent) && "Container objects can't be released on a shared context");
+
+		std::lock_guard<std::mutex> lock(mutex);
+		retiredNames.push_back(id);
+	}
 
+	void GC::Flush() {
+		std::lock_guard<std::mutex> lock(mutex);
+
+		DeleteFrames(~(uint64_t)0);
+		Delete(retiredNames);
+	}
+
+	uint GC::GetRetiredCount() const {
+		std::lock_guard<std::mutex> lock(mutex);
+
+		uint count = (uint)retiredNames.size();
+		for (size_t i = 0; i < retiredFrames.size(); i++)
+			count += (uint)retiredFrames[i].names.size();
+		return count;
+	}
+
+	bool GC::RetireFrame(uint64_t frame) {
+		std::lock_guard<std::mutex> lock(mutex);
+		if (retiredNames.empty()) return false;
+
+		retiredFrames.push_back(RetiredFrame());
+		retiredFrames.back().frame = frame;
+		retiredFrames.back().names.swap(retiredNames);
+
+		return true;
+	}
+
+	void GC::DeleteFrames(uint64_t completed) {
+		if (retiredFrames.empty() || retiredFrames.front().frame > completed) return;
+
+		// Gather every finished frame so they go out in a single call
+		std::vector<ID> names;
+		while (!retiredFrames.empty() && retiredFrames.front().frame <= completed) {
+			std::vector<ID>& frameNames = retiredFrames.front().names;
+			names.insert(names.end(), frameNames.begin(), frameNames.end());
+			retiredFrames.pop_front();
+		}
+
+		Delete(names);
+	}
+
+	void GC::EndFrame() {
+		std::lock_guard<std::mutex> lock(CollectorsMutex());
+
+		std::vector<GC*>& collectors = Collectors();
+		uint64_t frame = currentFrame++;
+
+		bool retired = false;
+		for (size_t i = 0; i < collectors.size(); i++)
+			retired = collectors[i]->RetireFrame(frame) || retired;
+
+		// Without fencing everything retired so far is considered done with,
+		// otherwise only frames whose fence has already signaled are
+		uint64_t completed = frame;
+		if (frameFencing) {
+			std::deque<FrameFence>& frameFences = FrameFences();
+			if (retired) {
+				frameFences.push_back(FrameFence());
+				frameFences.back().frame = frame;
+				frameFences.back().fence.Insert();
+			}
+
+			completed = 0;
+			while (!frameFences.empty() && frameFences.front().fence.IsSignaled()) {
+				completed = frameFences.front().frame;
+				frameFences.pop_front();
+			}
+		}
+
+		for (size_t i = 0; i < collectors.size(); i++) {
+			std::lock_guard<std::mutex> collectorLock(collectors[i]->mutex);
+			collectors[i]->DeleteFrames(completed);
+		}
+	}
+
+	void GC::FlushAll() {
+		std::lock_guard<std::mutex> lock(CollectorsMutex());
+
+		std::vector<GC*>& collectors = Collectors();
+		for (size_t i = 0; i < collectors.size(); i++)
+			collectors[i]->Flush();
+
+		FrameFences().clear();
+	}
+
+	void GC::SetFrameFencing(bool enabled) {
+		// Frames queued behind fences would otherwise wait for a fence that is
+		// never checked again
+		if (!enabled && GetFrameFencing()) FlushAll();
+
+		std::lock_guard<std::mutex> lock(CollectorsMutex());
+		frameFencing = enabled;
+	}
+
+	bool GC::GetFrameFencing() {
+		std::lock_guard<std::mutex> lock(CollectorsMutex());
+		return frameFencing;
+	}
+
+	uint GC::GetDeleteEpoch() {
+		return deleteEpoch.load(std::memory_order_relaxed);
+	}
+
+	void GC::SetSharedContextCurrent(bool shared) {
+		sharedContextCurrent = shared;
+	}
+
+	void GC::SetBatchSize(uint size) {
+		std::lock_guard<std::mutex> lock(mutex);
+		batchSize = size > 0 ? size : 1;
+	}
+
+	uint GC::GetBatchSize() const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return batchSize;
+	}
+
+	GC::Stats GC::GetStats() const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return stats;
+	}
+
+	void GC::SetFootprint(Handle handle, size_t bytes, bool mipChain) {
+		ptrdiff_t footprint = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			assert(Valid(handle) && "stale GC handle");
+			if (Valid(handle)) footprint = Account(handle & IndexMask, bytes, mipChain);
+		}
+
+		Memory::Track(category, footprint);
+	}
+
+	void GC::SetMipChain(Handle handle, bool mipChain) {
+		ptrdiff_t footprint = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			assert(Valid(handle) && "stale GC handle");
+			if (Valid(handle)) footprint = Account(handle & IndexMask, footprints[handle & IndexMask], mipChain);
+		}
+
+		Memory::Track(category, footprint);
+	}
+
+	size_t GC::GetFootprint(Handle handle) const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return Valid(handle) ? Footprint(handle & IndexMask) : 0;
+	}
+
+	bool GC::IsValid(Handle handle) const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return Valid(handle);
+	}
+
+	ID GC::GetID(Handle handle) const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return Valid(handle) ? ids[handle & IndexMask] : 0;
+	}
+
+	uint GC::GetRefCount(Handle handle) const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return Valid(handle) ? refs[handle & IndexMask] : 0;
+	}
+
+	uint GC::GetObjectCount() const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return (uint)(refs.size() - freeSlots.size());
+	}
+}
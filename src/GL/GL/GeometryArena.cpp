@@ -0,0 +1,245 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/GeometryArena.hpp>
+#include <algorithm>
+#include <assert.h>
+
+namespace GL
+{
+	GeometryArena::FreeList::FreeList( uint capacity )
+		: capacity( capacity ), free( 0 )
+	{
+		Reset( 0 );
+	}
+
+	uint GeometryArena::FreeList::Allocate( uint size )
+	{
+		for ( std::map<uint, uint>::iterator it = blocks.begin(); it != blocks.end(); ++it )
+		{
+			if ( it->second < size ) continue;
+
+			uint offset = it->first;
+			uint remaining = it->second - size;
+			blocks.erase( it );
+			if ( remaining > 0 ) blocks[offset + size] = remaining;
+
+			free -= size;
+			return offset;
+		}
+
+		return Full;
+	}
+
+	void GeometryArena::FreeList::Release( uint offset, uint size )
+	{
+		free += size;
+
+		std::map<uint, uint>::iterator next = blocks.lower_bound( offset );
+		if ( next != blocks.end() && offset + size == next->first ) {
+			size += next->second;
+			next = blocks.erase( next );
+		}
+
+		if ( next != blocks.begin() ) {
+			std::map<uint, uint>::iterator prev = next;
+			--prev;
+			if ( prev->first + prev->second == offset ) {
+				prev->second += size;
+				return;
+			}
+		}
+
+		blocks[offset] = size;
+	}
+
+	void GeometryArena::FreeList::Reset( uint used )
+	{
+		blocks.clear();
+		if ( used < capacity ) blocks[used] = capacity - used;
+		free = capacity - used;
+	}
+
+	GeometryArena::GeometryArena( uint vertexSize, uint vertexCapacity, uint indexCapacity, BufferUsage::buffer_usage_t usage )
+		: vertexSize( vertexSize ), vertexSpace( vertexCapacity ), indexSpace( indexCapacity ), scratchSize( 0 )
+	{
+		vertexBuffer.Data( 0, (size_t)vertexSize * vertexCapacity, usage );
+		indexBuffer.Data( 0, (size_t)indexCapacity * sizeof( uint ), usage );
+	}
+
+	GeometryArena::Handle GeometryArena::Allocate( const void* vertices, uint vertexCount, const uint* indices, uint indexCount )
+	{
+		if ( vertexCount == 0 || ( indices && indexCount == 0 ) ) return 0;
+
+		Range range;
+		if ( !Reserve( vertexCount, indices ? indexCount : vertexCount, range ) ) return 0;
+
+		vertexBuffer.SubData( vertices, (size_t)range.baseVertex * vertexSize, (size_t)vertexCount * vertexSize );
+
+		if ( indices ) {
+			indexBuffer.SubData( indices, (size_t)range.firstIndex * sizeof( uint ), (size_t)range.count * sizeof( uint ) );
+		} else {
+			std::vector<uint> sequential( vertexCount );
+			for ( uint i = 0; i < vertexCount; i++ ) sequential[i] = i;
+			indexBuffer.SubData( &sequential[0], (size_t)range.firstIndex * sizeof( uint ), (size_t)vertexCount * sizeof( uint ) );
+		}
+
+		Handle handle;
+		if ( freeHandles.empty() ) {
+			ranges.push_back( range );
+			handle = (Handle)ranges.size();
+		} else {
+			handle = freeHandles.back();
+			freeHandles.pop_back();
+			ranges[handle - 1] = range;
+		}
+
+		return handle;
+	}
+
+	GeometryArena::Handle GeometryArena::Allocate( const Mesh& mesh, std::function<void ( const Vertex& v, VertexDataBuffer& data )> f )
+	{
+		const Vertex* vertices = mesh.Vertices();
+		uint count = mesh.VertexCount();
+
+		VertexDataBuffer data( (size_t)count * vertexSize );
+		for ( uint i = 0; i < count; i++ )
+			f( vertices[i], data );
+
+		// The arena's layout is fixed, a mesh written with a different stride would corrupt its neighbours
+		if ( data.Size() != (size_t)count * vertexSize ) return 0;
+
+		return Allocate( data.Pointer(), count );
+	}
+
+	void GeometryArena::Free( Handle handle )
+	{
+		if ( handle == 0 ) return;
+		assert( handle <= ranges.size() && "invalid GeometryArena handle" );
+
+		Range& range = ranges[handle - 1];
+		if ( range.vertexCount == 0 ) return;
+
+		vertexSpace.Release( range.baseVertex, range.vertexCount );
+		indexSpace.Release( range.firstIndex, range.count );
+
+		range.vertexCount = range.count = 0;
+		freeHandles.push_back( handle );
+	}
+
+	DrawElementsIndirectCommand GeometryArena::GetDrawCommand( Handle handle, uint instances, uint baseInstance ) const
+	{
+		const Range& range = Get( handle );
+
+		DrawElementsIndirectCommand command;
+		command.count = range.count;
+		command.instanceCount = instances;
+		command.firstIndex = range.firstIndex;
+		command.baseVertex = range.baseVertex;
+		command.baseInstance = baseInstance;
+		return command;
+	}
+
+	static bool ByBaseVertex( const GeometryArena::Range* a, const GeometryArena::Range* b ) { return a->baseVertex < b->baseVertex; }
+	static bool ByFirstIndex( const GeometryArena::Range* a, const GeometryArena::Range* b ) { return a->firstIndex < b->firstIndex; }
+
+	void GeometryArena::Defragment()
+	{
+		std::vector<Range*> live;
+		for ( uint i = 0; i < ranges.size(); i++ )
+			if ( ranges[i].vertexCount > 0 ) live.push_back( &ranges[i] );
+
+		// Sliding everything down in order never moves a mesh onto one that hasn't moved yet
+		std::sort( live.begin(), live.end(), ByBaseVertex );
+		uint vertices = 0;
+		for ( uint i = 0; i < live.size(); i++ )
+		{
+			Move( vertexBuffer, vertexSize, live[i]->baseVertex, vertices, live[i]->vertexCount );
+			live[i]->baseVertex = vertices;
+			vertices += live[i]->vertexCount;
+		}
+
+		std::sort( live.begin(), live.end(), ByFirstIndex );
+		uint indices = 0;
+		for ( uint i = 0; i < live.size(); i++ )
+		{
+			Move( indexBuffer, sizeof( uint ), live[i]->firstIndex, indices, live[i]->count );
+			live[i]->firstIndex = indices;
+			indices += live[i]->count;
+		}
+
+		vertexSpace.Reset( vertices );
+		indexSpace.Reset( indices );
+	}
+
+	bool GeometryArena::Reserve( uint vertexCount, uint indexCount, Range& range )
+	{
+		if ( vertexCount > vertexSpace.GetFree() || indexCount > indexSpace.GetFree() ) return false;
+
+		uint baseVertex = vertexSpace.Allocate( vertexCount );
+		uint firstIndex = indexSpace.Allocate( indexCount );
+
+		if ( baseVertex == FreeList::Full || firstIndex == FreeList::Full ) {
+			if ( baseVertex != FreeList::Full ) vertexSpace.Release( baseVertex, vertexCount );
+			if ( firstIndex != FreeList::Full ) indexSpace.Release( firstIndex, indexCount );
+
+			// There is room, just not in one piece
+			Defragment();
+			baseVertex = vertexSpace.Allocate( vertexCount );
+			firstIndex = indexSpace.Allocate( indexCount );
+		}
+
+		range.baseVertex = baseVertex;
+		range.firstIndex = firstIndex;
+		range.count = indexCount;
+		range.vertexCount = vertexCount;
+		return true;
+	}
+
+	void GeometryArena::Move( const VertexBuffer& buffer, uint elementSize, uint from, uint to, uint count )
+	{
+		if ( from == to ) return;
+
+		size_t src = (size_t)from * elementSize;
+		size_t dst = (size_t)to * elementSize;
+		size_t length = (size_t)count * elementSize;
+
+		glBindBuffer( GL_COPY_READ_BUFFER, buffer );
+		glBindBuffer( GL_COPY_WRITE_BUFFER, buffer );
+
+		if ( src - dst >= length ) {
+			glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, src, dst, length );
+			return;
+		}
+
+		// Source and destination can't overlap within one copy, so a close move goes through scratch space
+		if ( length > scratchSize ) {
+			scratch.Data( 0, length, BufferUsage::StreamCopy );
+			scratchSize = length;
+		}
+
+		glBindBuffer( GL_COPY_WRITE_BUFFER, scratch );
+		glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, src, 0, length );
+		glBindBuffer( GL_COPY_READ_BUFFER, scratch );
+		glBindBuffer( GL_COPY_WRITE_BUFFER, buffer );
+		glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, dst, length );
+	}
+}
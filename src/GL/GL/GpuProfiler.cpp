@@ -0,0 +1,214 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/GpuProfiler.hpp>
+#include <GL/GL/Features.hpp>
+#include <cstring>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
+{
+	GpuProfiler::GpuProfiler( uint bufferedFrames )
+		: frames( bufferedFrames < 2 ? 2 : bufferedFrames ), current( 0 ), frameNumber( 0 ),
+		frameTime( 0.0 ), resultFrame( 0 ), skippedFrames( 0 )
+	{
+		enabled = HasFeature( Feature::TimerQuery );
+
+		for ( size_t i = 0; i < frames.size(); i++ )
+		{
+			Frame& frame = frames[i];
+			frame.number = 0;
+			frame.recording = frame.pending = false;
+			frame.elapsedQuery = 0;
+			frame.usedQueries = 0;
+			if ( enabled ) glGenQueries( 1, &frame.elapsedQuery );
+		}
+	}
+
+	GpuProfiler::~GpuProfiler()
+	{
+		if ( !enabled ) return;
+
+		for ( size_t i = 0; i < frames.size(); i++ )
+		{
+			Frame& frame = frames[i];
+			glDeleteQueries( 1, &frame.elapsedQuery );
+			if ( !frame.queries.empty() ) glDeleteQueries( (GLsizei)frame.queries.size(), &frame.queries[0] );
+		}
+	}
+
+	void GpuProfiler::BeginFrame()
+	{
+		if ( !enabled ) return;
+
+		frameNumber++;
+
+		// Pick up whatever finished in the meantime, oldest first
+		for ( size_t i = 1; i <= frames.size(); i++ )
+		{
+			Frame& frame = frames[( current + i ) % frames.size()];
+			if ( frame.pending && Available( frame ) ) Collect( frame );
+		}
+
+		// Still waiting on the GPU for this slot, so leave this frame out
+		Frame& frame = frames[current];
+		if ( frame.pending ) {
+			skippedFrames++;
+			return;
+		}
+
+		frame.number = frameNumber;
+		frame.recording = true;
+		frame.usedQueries = 0;
+		frame.marks.clear();
+		open.clear();
+
+		glBeginQuery( GL_TIME_ELAPSED, frame.elapsedQuery );
+	}
+
+	void GpuProfiler::EndFrame()
+	{
+		if ( !enabled ) return;
+
+		Frame& frame = frames[current];
+		if ( !frame.recording ) return;
+
+		while ( !open.empty() ) End();
+
+		glEndQuery( GL_TIME_ELAPSED );
+		frame.recording = false;
+		frame.pending = true;
+
+		current = ( current + 1 ) % frames.size();
+	}
+
+	void GpuProfiler::Begin( const char* name )
+	{
+		if ( !enabled ) return;
+
+		Frame& frame = frames[current];
+		if ( !frame.recording ) return;
+
+		Mark mark;
+		mark.name = name;
+		mark.depth = (uint)open.size();
+		mark.parent = open.empty() ? -1 : (int)open.back();
+		mark.begin = Timestamp( frame );
+		mark.end = mark.begin;
+
+		open.push_back( (uint)frame.marks.size() );
+		frame.marks.push_back( mark );
+	}
+
+	void GpuProfiler::End()
+	{
+		if ( !enabled ) return;
+
+		Frame& frame = frames[current];
+		if ( !frame.recording || open.empty() ) return;
+
+		frame.marks[open.back()].end = Timestamp( frame );
+		open.pop_back();
+	}
+
+	uint GpuProfiler::Timestamp( Frame& frame )
+	{
+		if ( frame.usedQueries == frame.queries.size() ) {
+			GLuint query;
+			glGenQueries( 1, &query );
+			frame.queries.push_back( query );
+		}
+
+		glQueryCounter( frame.queries[frame.usedQueries], GL_TIMESTAMP );
+		return frame.usedQueries++;
+	}
+
+	bool GpuProfiler::Available( const Frame& frame ) const
+	{
+		GLint available;
+
+		glGetQueryObjectiv( frame.elapsedQuery, GL_QUERY_RESULT_AVAILABLE, &available );
+		if ( !available ) return false;
+
+		for ( uint i = 0; i < frame.usedQueries; i++ )
+		{
+			glGetQueryObjectiv( frame.queries[i], GL_QUERY_RESULT_AVAILABLE, &available );
+			if ( !available ) return false;
+		}
+
+		return true;
+	}
+
+	void GpuProfiler::Collect( Frame& frame )
+	{
+		frame.pending = false;
+
+		// Only frames newer than the current results replace them
+		if ( frame.number < resultFrame ) return;
+		resultFrame = frame.number;
+
+		GLuint64 elapsed;
+		glGetQueryObjectui64v( frame.elapsedQuery, GL_QUERY_RESULT, &elapsed );
+		frameTime = elapsed / 1e6;
+
+		results.clear();
+		resultIndex.resize( frame.marks.size() );
+
+		for ( size_t i = 0; i < frame.marks.size(); i++ )
+		{
+			const Mark& mark = frame.marks[i];
+			int parent = mark.parent < 0 ? -1 : resultIndex[mark.parent];
+
+			GLuint64 begin, end;
+			glGetQueryObjectui64v( frame.queries[mark.begin], GL_QUERY_RESULT, &begin );
+			glGetQueryObjectui64v( frame.queries[mark.end], GL_QUERY_RESULT, &end );
+			double milliseconds = end > begin ? ( end - begin ) / 1e6 : 0.0;
+
+			int index = -1;
+			for ( size_t r = 0; r < results.size(); r++ )
+			{
+				if ( results[r].parent == parent && strcmp( results[r].name, mark.name ) == 0 ) {
+					index = (int)r;
+					break;
+				}
+			}
+
+			if ( index < 0 ) {
+				Result result;
+				result.name = mark.name;
+				result.depth = mark.depth;
+				result.parent = parent;
+				result.calls = 0;
+				result.milliseconds = 0.0;
+
+				index = (int)results.size();
+				results.push_back( result );
+			}
+
+			results[index].calls++;
+			results[index].milliseconds += milliseconds;
+			resultIndex[i] = index;
+		}
+	}
+}
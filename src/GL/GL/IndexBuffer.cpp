@@ -1,15 +1,10 @@
 
 #include <GL/GL/IndexBuffer.hpp>
 
-GL::GC IndexBuffer::gc;
-
-IndexBuffer::operator GLuint() const {
-	return m_ID;
-}
-
 void IndexBuffer::Data(const GLvoid* data, GLsizeiptr  lenght, GLenum usage) {
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ID);
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, lenght, data, usage);
+	SetFootprint(lenght);
 }
 				
 void IndexBuffer::SubData(const GLvoid* data, GLsizeiptr offset , GLsizeiptr length){
@@ -22,29 +17,36 @@ void IndexBuffer::GetSubData(GLvoid* data, GLsizeiptr  offset, GLsizeiptr length
 	glGetBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, length, data);
 }
 
-IndexBuffer::IndexBuffer() {
-	m_ID = gc.Create(m_GeneratorFunc);
+// Mapping goes through a target that isn't vertex array state, so the bound VAO keeps its element buffer
+GLvoid* IndexBuffer::Map(GLbitfield access) {
+	GLint size = 0;
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_ID);
+	glGetBufferParameteriv(GL_COPY_WRITE_BUFFER, GL_BUFFER_SIZE, &size);
+	return size > 0 ? MapRange(0, size, access) : 0;
 }
 
-IndexBuffer::IndexBuffer(const IndexBuffer& rhs) {
-	gc.Copy(m_ID, rhs.m_ID);
+GLvoid* IndexBuffer::MapRange(GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_ID);
+	return glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, length, access);
 }
 
-const IndexBuffer& IndexBuffer::operator=(const IndexBuffer& rhs) {
-//	gc.Destroy(m_ID, m_DeleterFunc);
-	gc.Copy(m_ID, rhs.m_ID);
-	return *this;
+void IndexBuffer::FlushMappedRange(GLintptr offset, GLsizeiptr length) {
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_ID);
+	glFlushMappedBufferRange(GL_COPY_WRITE_BUFFER, offset, length);
 }
 
-IndexBuffer::~IndexBuffer() {
-	gc.Destroy(m_ID, m_DeleterFunc);
+bool IndexBuffer::Unmap() {
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_ID);
+	return glUnmapBuffer(GL_COPY_WRITE_BUFFER) == GL_TRUE;
+}
+
+IndexBuffer::IndexBuffer() {
 }
 
 IndexBuffer::IndexBuffer(const GLvoid* data, GLsizei length, GLenum usage) {
-	m_ID = gc.Create(m_GeneratorFunc);
 	Data(data, length, usage);
 }
 
 void IndexBuffer::Destroy() {
-	gc.Destroy(m_ID, m_DeleterFunc);
+	GLObject::Destroy();
 }
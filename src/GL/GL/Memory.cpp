@@ -0,0 +1,87 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/Memory.hpp>
+#include <atomic>
+#include <mutex>
+
+namespace GL
+{
+	static std::atomic<size_t> usage[MemoryCategory::Count];
+	static std::atomic<size_t> totalUsage( 0 );
+	static std::atomic<size_t> peakUsage( 0 );
+	static std::atomic<size_t> budget( 0 );
+
+	static std::mutex callbackMutex;
+	static Memory::BudgetCallback budgetCallback;
+
+	size_t Memory::GetUsage()
+	{
+		return totalUsage;
+	}
+
+	size_t Memory::GetUsage( MemoryCategory::memory_category_t category )
+	{
+		return usage[category];
+	}
+
+	size_t Memory::GetPeakUsage()
+	{
+		return peakUsage;
+	}
+
+	void Memory::SetBudget( size_t bytes, const BudgetCallback& callback )
+	{
+		std::lock_guard<std::mutex> lock( callbackMutex );
+		budgetCallback = callback;
+		budget = bytes;
+	}
+
+	size_t Memory::GetBudget()
+	{
+		return budget;
+	}
+
+	void Memory::Track( MemoryCategory::memory_category_t category, ptrdiff_t bytes )
+	{
+		if ( bytes == 0 ) return;
+
+		usage[category] += bytes;
+		size_t total = totalUsage += bytes;
+
+		if ( bytes < 0 ) return;
+
+		size_t peak = peakUsage;
+		while ( total > peak && !peakUsage.compare_exchange_weak( peak, total ) );
+
+		// Only the allocation that crosses the budget reports it
+		size_t limit = budget;
+		if ( limit > 0 && total >= limit && total - bytes < limit )
+		{
+			BudgetCallback callback;
+			{
+				std::lock_guard<std::mutex> lock( callbackMutex );
+				callback = budgetCallback;
+			}
+			if ( callback ) callback( total, limit );
+		}
+	}
+}
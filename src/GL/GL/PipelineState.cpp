@@ -0,0 +1,152 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/PipelineState.hpp>
+#include <GL/GL/StateCache.hpp>
+#include <cstring>
+
+namespace GL
+{
+	PipelineState::PipelineState()
+	{
+		// The initial values of a context
+		capabilities = 0;
+		depthMask = 1;
+		depthFunction = GL_LESS;
+		stencilMask = ~0u;
+		stencilFunction = GL_ALWAYS;
+		stencilReference = 0;
+		stencilFuncMask = ~0u;
+		stencilFail = stencilZFail = stencilPass = GL_KEEP;
+		cullFace = GL_BACK;
+		blendSource = GL_ONE;
+		blendDestination = GL_ZERO;
+		blendEquation = GL_FUNC_ADD;
+		colorMask = 0xF;
+	}
+
+	PipelineState PipelineState::Enable( Capability::capability_t capability ) const
+	{
+		PipelineState state = *this;
+		state.capabilities |= StateCache::CapabilityBit( capability );
+		return state;
+	}
+
+	PipelineState PipelineState::Disable( Capability::capability_t capability ) const
+	{
+		PipelineState state = *this;
+		state.capabilities &= ~StateCache::CapabilityBit( capability );
+		return state;
+	}
+
+	PipelineState PipelineState::DepthFunc( TestFunction::test_function_t function ) const
+	{
+		PipelineState state = *this;
+		state.depthFunction = function;
+		return state;
+	}
+
+	PipelineState PipelineState::DepthMask( bool writeEnabled ) const
+	{
+		PipelineState state = *this;
+		state.depthMask = writeEnabled ? 1 : 0;
+		return state;
+	}
+
+	PipelineState PipelineState::StencilFunc( TestFunction::test_function_t function, int reference, uint mask ) const
+	{
+		PipelineState state = *this;
+		state.stencilFunction = function;
+		state.stencilReference = reference;
+		state.stencilFuncMask = mask;
+		return state;
+	}
+
+	PipelineState PipelineState::StencilOp( StencilAction::stencil_action_t fail, StencilAction::stencil_action_t zfail, StencilAction::stencil_action_t pass ) const
+	{
+		PipelineState state = *this;
+		state.stencilFail = fail;
+		state.stencilZFail = zfail;
+		state.stencilPass = pass;
+		return state;
+	}
+
+	PipelineState PipelineState::StencilMask( uint mask ) const
+	{
+		PipelineState state = *this;
+		state.stencilMask = mask;
+		return state;
+	}
+
+	PipelineState PipelineState::CullFace( Face::face_t face ) const
+	{
+		PipelineState state = *this;
+		state.cullFace = face;
+		return state;
+	}
+
+	PipelineState PipelineState::BlendFunc( BlendFactor::blend_factor_t source, BlendFactor::blend_factor_t destination ) const
+	{
+		PipelineState state = *this;
+		state.blendSource = source;
+		state.blendDestination = destination;
+		return state;
+	}
+
+	PipelineState PipelineState::BlendEquation( BlendEquation::blend_equation_t equation ) const
+	{
+		PipelineState state = *this;
+		state.blendEquation = equation;
+		return state;
+	}
+
+	PipelineState PipelineState::ColorMask( bool red, bool green, bool blue, bool alpha ) const
+	{
+		PipelineState state = *this;
+		state.colorMask = ( red ? 1 : 0 ) | ( green ? 2 : 0 ) | ( blue ? 4 : 0 ) | ( alpha ? 8 : 0 );
+		return state;
+	}
+
+	bool PipelineState::IsEnabled( Capability::capability_t capability ) const
+	{
+		return ( capabilities & StateCache::CapabilityBit( capability ) ) != 0;
+	}
+
+	uint64_t PipelineState::Hash() const
+	{
+		// FNV-1a over the fields
+		const uchar* bytes = (const uchar*)this;
+		uint64_t hash = 0xCBF29CE484222325ull;
+		for ( size_t i = 0; i < sizeof( PipelineState ); i++ )
+			hash = ( hash ^ bytes[i] ) * 0x100000001B3ull;
+		return hash;
+	}
+
+	bool PipelineState::operator==( const PipelineState& other ) const
+	{
+		return memcmp( this, &other, sizeof( PipelineState ) ) == 0;
+	}
+
+	bool PipelineState::operator!=( const PipelineState& other ) const
+	{
+		return !( *this == other );
+	}
+}
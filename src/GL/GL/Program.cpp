@@ -20,63 +20,37 @@
 */
 
 #include <GL/GL/Program.hpp>
+#include <GL/GL/StateCache.hpp>
+#include <GL/Util/Profiler.hpp>
 #include <vector>
 
 namespace GL
 {
 	Program::Program() {
-		m_ID = m_GeneratorFunc();
-		gc.Create(m_ID);
-	}
-
-	Program::Program(const Program& rhs) {
-		gc.Copy(m_ID, rhs.m_ID);
 	}
 
 	Program::Program(const Shader& vertexShader) {
-		m_ID = m_GeneratorFunc();
-		gc.Create(m_ID);
 		Attach(vertexShader);
 		Link();
-		glUseProgram(m_ID);
+		StateCache::UseProgram(m_ID);
 	}
 
 	Program::Program(const Shader& vertex, const Shader& fragment)
 	{
-		m_ID = m_GeneratorFunc();
-		gc.Create(m_ID);
 		Attach(vertex);
 		Attach(fragment);
 		Link();
-		glUseProgram(m_ID);
+		StateCache::UseProgram(m_ID);
 	}
 
 	Program::Program(const Shader& vertex, const Shader& fragment, const Shader& geometry)
 	{
-		m_ID = m_GeneratorFunc();
-		gc.Create(m_ID);
 		Attach(vertex);
 		Attach(fragment);
 		Attach(geometry);
 		Link();
-		glUseProgram(m_ID);
-
-	}
+		StateCache::UseProgram(m_ID);
 
-	const Program& Program::operator=(const Program& rhs) {
-		gc.Destroy(m_ID, m_DeleterFunc);
-		gc.Copy(m_ID, rhs.m_ID);
-		return *this;
-	}
-
-	Program::~Program()
-	{
-		gc.Destroy(m_ID, m_DeleterFunc);
-	}
-
-	Program::operator GLuint() const
-	{
-		return m_ID;
 	}
 
 	void Program::Attach(const Shader& shader)
@@ -91,6 +65,8 @@ namespace GL
 
 	void Program::Link()
 	{
+		OOGL_PROFILE_SCOPE("Program::Link");
+
 		GLint res;
 
 		glLinkProgram(m_ID);
@@ -183,5 +159,4 @@ namespace GL
 		glUniformMatrix4fv(uniform, 1, GL_FALSE, value.m);
 	}
 
-	GC Program::gc;
 }
\ No newline at end of file
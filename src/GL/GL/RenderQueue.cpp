@@ -0,0 +1,204 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/RenderQueue.hpp>
+#include <algorithm>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
+{
+	// Folds a name into the given number of bits
+	static uint64_t Fold( uint64_t value, uint bits )
+	{
+		value *= 0x9E3779B97F4A7C15ull;
+		return value >> ( 64 - bits );
+	}
+
+	RenderQueue::RenderQueue( uint reserve )
+	{
+		commands.reserve( reserve );
+		order.reserve( reserve );
+		sorted.reserve( reserve );
+
+		layer = 0;
+		pipeline = 0;
+		ResetBindings();
+		stats = Stats();
+	}
+
+	void RenderQueue::SetLayer( uchar layer )
+	{
+		this->layer = layer;
+	}
+
+	void RenderQueue::SetPipelineState( const PipelineState& state )
+	{
+		// Frames only use a handful of distinct states, the last one is the likeliest
+		for ( size_t i = pipelines.size(); i > 0; i-- )
+		{
+			if ( pipelines[i - 1] == state ) {
+				pipeline = (uint)i;
+				return;
+			}
+		}
+
+		pipelines.push_back( state );
+		pipeline = (uint)pipelines.size();
+	}
+
+	void RenderQueue::BindTexture( const Texture& texture, uchar unit )
+	{
+		if ( unit < DrawCommand::MaxTextures ) textures[unit] = texture;
+	}
+
+	void RenderQueue::BindUniformBuffer( const VertexBuffer& buffer )
+	{
+		uniformBuffer = buffer;
+	}
+
+	void RenderQueue::ResetBindings()
+	{
+		for ( uint i = 0; i < DrawCommand::MaxTextures; i++ ) textures[i] = 0;
+		uniformBuffer = 0;
+	}
+
+	void RenderQueue::DrawArrays( const Program& program, const VertexArray& vao, Primitive::primitive_t mode, uint offset, uint vertices )
+	{
+		Record( program, vao, mode, offset, vertices, 0 );
+	}
+
+	void RenderQueue::DrawElements( const Program& program, const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, uint type )
+	{
+		Record( program, vao, mode, offset, count, type );
+	}
+
+	void RenderQueue::Record( const Program& program, const VertexArray& vao, Primitive::primitive_t mode, intptr_t offset, uint count, GLenum indexType )
+	{
+		DrawCommand command;
+		command.program = program;
+		command.vao = vao;
+		for ( uint i = 0; i < DrawCommand::MaxTextures; i++ ) command.textures[i] = textures[i];
+		command.uniformBuffer = uniformBuffer;
+		command.pipeline = pipeline;
+		command.mode = mode;
+		command.offset = offset;
+		command.count = count;
+		command.indexType = indexType;
+		command.key = MakeKey( layer, pipeline ? pipelines[pipeline - 1].Hash() : 0, command );
+
+		commands.push_back( command );
+	}
+
+	uint64_t RenderQueue::MakeKey( uchar layer, uint64_t pipelineHash, const DrawCommand& command )
+	{
+		uint64_t textureHash = 0;
+		for ( uint i = 0; i < DrawCommand::MaxTextures; i++ )
+			textureHash = textureHash * 31 + command.textures[i];
+
+		return (uint64_t)layer << 56 |
+			Fold( pipelineHash, 8 ) << 48 |
+			Fold( command.program, 16 ) << 32 |
+			Fold( textureHash, 12 ) << 20 |
+			Fold( command.uniformBuffer, 8 ) << 12 |
+			Fold( command.vao, 12 );
+	}
+
+	uint RenderQueue::CountStateChanges( const DrawCommand* const* commands, uint count )
+	{
+		uint changes = 0;
+		const DrawCommand* last = 0;
+
+		for ( uint i = 0; i < count; i++ )
+		{
+			const DrawCommand& command = *commands[i];
+
+			if ( command.pipeline && ( !last || last->pipeline != command.pipeline ) ) changes++;
+			if ( !last || last->program != command.program ) changes++;
+			if ( !last || last->vao != command.vao ) changes++;
+			for ( uint t = 0; t < DrawCommand::MaxTextures; t++ )
+				if ( command.textures[t] && ( !last || last->textures[t] != command.textures[t] ) ) changes++;
+			if ( command.uniformBuffer && ( !last || last->uniformBuffer != command.uniformBuffer ) ) changes++;
+
+			last = &command;
+		}
+
+		return changes;
+	}
+
+	void RenderQueue::Submit()
+	{
+		uint count = (uint)commands.size();
+
+		// Sort indices rather than the commands, ties keep the recording order
+		order.resize( count );
+		for ( uint i = 0; i < count; i++ )
+			order[i] = std::make_pair( commands[i].key, i );
+		std::sort( order.begin(), order.end() );
+
+		sorted.resize( count );
+		for ( uint i = 0; i < count; i++ ) sorted[i] = &commands[i];
+
+		stats.commands = count;
+		stats.changesUnsorted = CountStateChanges( sorted.data(), count );
+
+		for ( uint i = 0; i < count; i++ ) sorted[i] = &commands[order[i].second];
+
+		stats.changesSorted = CountStateChanges( sorted.data(), count );
+
+		// Redundant binds are left to the state cache
+		for ( uint i = 0; i < count; i++ )
+		{
+			const DrawCommand& command = *sorted[i];
+
+			if ( command.pipeline ) StateCache::SetPipelineState( pipelines[command.pipeline - 1] );
+			StateCache::UseProgram( command.program );
+			for ( uint t = 0; t < DrawCommand::MaxTextures; t++ )
+				if ( command.textures[t] ) StateCache::BindTexture( t, command.textures[t] );
+			if ( command.uniformBuffer ) StateCache::BindUniformBuffer( 0, command.uniformBuffer );
+			StateCache::BindVertexArray( command.vao );
+
+			if ( command.indexType )
+				glDrawElements( command.mode, command.count, command.indexType, (const GLvoid*)command.offset );
+			else
+				glDrawArrays( command.mode, (GLint)command.offset, command.count );
+		}
+
+		Clear();
+	}
+
+	void RenderQueue::Clear()
+	{
+		commands.clear();
+
+		// The current state carries over, like the layer and bindings do
+		if ( pipeline ) {
+			PipelineState current = pipelines[pipeline - 1];
+			pipelines.clear();
+			pipelines.push_back( current );
+			pipeline = 1;
+		} else {
+			pipelines.clear();
+		}
+	}
+}
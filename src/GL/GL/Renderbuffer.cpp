@@ -25,41 +25,18 @@ namespace GL
 {
 	Renderbuffer::Renderbuffer()
 	{
-		gc.Create( obj, glGenRenderbuffers, glDeleteRenderbuffers );
-	}
-
-	Renderbuffer::Renderbuffer( const Renderbuffer& other )
-	{
-		gc.Copy( other.obj, obj );
 	}
 
 	Renderbuffer::Renderbuffer( uint width, uint height, InternalFormat::internal_format_t format )
 	{
-		gc.Create( obj, glGenRenderbuffers, glDeleteRenderbuffers );
 		Storage( width, height, format );
 	}
 
-	Renderbuffer::~Renderbuffer()
-	{
-		gc.Destroy( obj );
-	}
-
-	Renderbuffer::operator GLuint() const
-	{
-		return obj;
-	}
-
-	const Renderbuffer& Renderbuffer::operator=( const Renderbuffer& other )
-	{
-		gc.Copy( other.obj, obj, true );
-		return *this;
-	}
-
 	void Renderbuffer::Storage( uint width, uint height, InternalFormat::internal_format_t format )
 	{
-		glBindRenderbuffer( GL_RENDERBUFFER, obj );
+		glBindRenderbuffer( GL_RENDERBUFFER, m_ID );
 		glRenderbufferStorage( GL_RENDERBUFFER, format, width, height );
-	}
 
-	GC Renderbuffer::gc;
+		SetFootprint( (size_t)width * height * InternalFormat::GetBitsPerPixel( format ) / 8 );
+	}
 }
\ No newline at end of file
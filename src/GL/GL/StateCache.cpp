@@ -0,0 +1,377 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/StateCache.hpp>
+#include <GL/GL/PipelineState.hpp>
+#include <GL/GL/GC.hpp>
+
+#if !defined(__GLEW_H__)
+ #include <GL/GL/Extensions.hpp>
+#endif
+
+namespace GL
+{
+	// Marks a cached value that doesn't match any real one
+	static const GLuint Unknown = StateCache::Unknown;
+
+	struct CachedState
+	{
+		uint deleteEpoch;
+
+		GLuint program;
+		GLuint vao;
+		GLuint framebuffer;
+		GLuint drawIndirectBuffer;
+		uint activeUnit;
+		GLuint textures[StateCache::TextureUnits];
+		GLuint uniformBuffers[StateCache::UniformBufferBindings];
+
+		uint knownCapabilities;
+		uint enabledCapabilities;
+
+		// Which of the values below have been set since the last Forget()
+		uint known;
+
+		bool depthMask;
+		uint stencilMask;
+		GLenum stencilFunction;
+		int stencilReference;
+		uint stencilFuncMask;
+		GLenum stencilFail, stencilZFail, stencilPass;
+		GLenum depthFunction;
+		GLenum cullFace;
+		GLenum blendSource, blendDestination;
+		GLenum blendEquation;
+		uint colorMask;
+		int viewport[4];
+
+		// Last state applied as a whole, valid while KnownPipeline is set
+		PipelineState pipeline;
+
+		StateCache::Stats stats;
+
+		CachedState() : stats() { Forget(); }
+
+		void ForgetBindings()
+		{
+			deleteEpoch = GC::GetDeleteEpoch();
+			program = vao = framebuffer = drawIndirectBuffer = Unknown;
+			activeUnit = Unknown;
+			for ( uint i = 0; i < StateCache::TextureUnits; i++ ) textures[i] = Unknown;
+			for ( uint i = 0; i < StateCache::UniformBufferBindings; i++ ) uniformBuffers[i] = Unknown;
+		}
+
+		void Forget()
+		{
+			ForgetBindings();
+
+			knownCapabilities = enabledCapabilities = 0;
+			known = 0;
+		}
+
+		// Returns true if the state is already set, and counts the call either way
+		bool Known( uint bit, bool same );
+
+		// Returns true if the call has to be issued, and counts it either way
+		bool Update( GLuint& cached, GLuint value )
+		{
+			if ( cached == value ) {
+				stats.skipped++;
+				return false;
+			}
+
+			cached = value;
+			stats.issued++;
+			return true;
+		}
+	};
+
+	// One cache per thread, as a context is only ever current on one thread
+	static thread_local CachedState state;
+
+	static CachedState& Bindings()
+	{
+		if ( state.deleteEpoch != GC::GetDeleteEpoch() ) state.ForgetBindings();
+		return state;
+	}
+
+	enum
+	{
+		KnownDepthMask = 1 << 0,
+		KnownStencilMask = 1 << 1,
+		KnownStencilFunc = 1 << 2,
+		KnownStencilOp = 1 << 3,
+		KnownViewport = 1 << 4,
+		KnownDepthFunc = 1 << 5,
+		KnownCullFace = 1 << 6,
+		KnownBlendFunc = 1 << 7,
+		KnownBlendEquation = 1 << 8,
+		KnownColorMask = 1 << 9,
+		KnownPipeline = 1 << 10
+	};
+
+	bool CachedState::Known( uint bit, bool same )
+	{
+		if ( ( known & bit ) && same ) {
+			stats.skipped++;
+			return true;
+		}
+
+		// Anything but the viewport is part of a pipeline state
+		known |= bit;
+		if ( bit != KnownViewport ) known &= ~KnownPipeline;
+		stats.issued++;
+		return false;
+	}
+
+	uint StateCache::CapabilityBit( GLenum capability )
+	{
+		switch ( capability )
+		{
+			case GL_DEPTH_TEST: return 1 << 0;
+			case GL_STENCIL_TEST: return 1 << 1;
+			case GL_CULL_FACE: return 1 << 2;
+			case GL_RASTERIZER_DISCARD: return 1 << 3;
+			case GL_BLEND: return 1 << 4;
+			default: return 0;
+		}
+	}
+
+	void StateCache::UseProgram( GLuint program )
+	{
+		if ( Bindings().Update( state.program, program ) ) glUseProgram( program );
+	}
+
+	void StateCache::BindVertexArray( GLuint vao )
+	{
+		if ( Bindings().Update( state.vao, vao ) ) glBindVertexArray( vao );
+	}
+
+	void StateCache::BindTexture( uint unit, GLuint texture )
+	{
+		CachedState& cache = Bindings();
+
+		if ( unit >= TextureUnits ) {
+			glActiveTexture( GL_TEXTURE0 + unit );
+			glBindTexture( GL_TEXTURE_2D, texture );
+			cache.activeUnit = unit;
+			cache.stats.issued += 2;
+			return;
+		}
+
+		if ( cache.textures[unit] == texture ) {
+			cache.stats.skipped++;
+			return;
+		}
+
+		if ( cache.Update( cache.activeUnit, unit ) ) glActiveTexture( GL_TEXTURE0 + unit );
+		cache.Update( cache.textures[unit], texture );
+		glBindTexture( GL_TEXTURE_2D, texture );
+	}
+
+	void StateCache::BindFramebuffer( GLuint framebuffer )
+	{
+		if ( Bindings().Update( state.framebuffer, framebuffer ) ) glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffer );
+	}
+
+	void StateCache::BindUniformBuffer( uint index, GLuint buffer )
+	{
+		CachedState& cache = Bindings();
+
+		if ( index >= UniformBufferBindings ) {
+			glBindBufferBase( GL_UNIFORM_BUFFER, index, buffer );
+			cache.stats.issued++;
+			return;
+		}
+
+		if ( cache.Update( cache.uniformBuffers[index], buffer ) ) glBindBufferBase( GL_UNIFORM_BUFFER, index, buffer );
+	}
+
+	void StateCache::BindDrawIndirectBuffer( GLuint buffer )
+	{
+		if ( Bindings().Update( state.drawIndirectBuffer, buffer ) ) glBindBuffer( GL_DRAW_INDIRECT_BUFFER, buffer );
+	}
+
+	uint StateCache::GetActiveUnit()
+	{
+		return Bindings().activeUnit;
+	}
+
+	GLuint StateCache::GetTexture( uint unit )
+	{
+		return unit < TextureUnits ? Bindings().textures[unit] : Unknown;
+	}
+
+	GLuint StateCache::GetFramebuffer()
+	{
+		return Bindings().framebuffer;
+	}
+
+	void StateCache::SetCapability( GLenum capability, bool enabled )
+	{
+		uint bit = CapabilityBit( capability );
+
+		if ( bit && ( state.knownCapabilities & bit ) && ( ( state.enabledCapabilities & bit ) != 0 ) == enabled ) {
+			state.stats.skipped++;
+			return;
+		}
+
+		state.knownCapabilities |= bit;
+		state.known &= ~KnownPipeline;
+		if ( enabled ) state.enabledCapabilities |= bit;
+		else state.enabledCapabilities &= ~bit;
+		state.stats.issued++;
+
+		if ( enabled ) glEnable( capability );
+		else glDisable( capability );
+	}
+
+	void StateCache::DepthMask( bool writeEnabled )
+	{
+		if ( state.Known( KnownDepthMask, state.depthMask == writeEnabled ) ) return;
+
+		state.depthMask = writeEnabled;
+		glDepthMask( writeEnabled ? GL_TRUE : GL_FALSE );
+	}
+
+	void StateCache::StencilMask( uint mask )
+	{
+		if ( state.Known( KnownStencilMask, state.stencilMask == mask ) ) return;
+
+		state.stencilMask = mask;
+		glStencilMask( mask );
+	}
+
+	void StateCache::StencilFunc( GLenum function, int reference, uint mask )
+	{
+		if ( state.Known( KnownStencilFunc, state.stencilFunction == function && state.stencilReference == reference && state.stencilFuncMask == mask ) ) return;
+
+		state.stencilFunction = function;
+		state.stencilReference = reference;
+		state.stencilFuncMask = mask;
+		glStencilFunc( function, reference, mask );
+	}
+
+	void StateCache::StencilOp( GLenum fail, GLenum zfail, GLenum pass )
+	{
+		if ( state.Known( KnownStencilOp, state.stencilFail == fail && state.stencilZFail == zfail && state.stencilPass == pass ) ) return;
+
+		state.stencilFail = fail;
+		state.stencilZFail = zfail;
+		state.stencilPass = pass;
+		glStencilOp( fail, zfail, pass );
+	}
+
+	void StateCache::DepthFunc( GLenum function )
+	{
+		if ( state.Known( KnownDepthFunc, state.depthFunction == function ) ) return;
+
+		state.depthFunction = function;
+		glDepthFunc( function );
+	}
+
+	void StateCache::CullFace( GLenum face )
+	{
+		if ( state.Known( KnownCullFace, state.cullFace == face ) ) return;
+
+		state.cullFace = face;
+		glCullFace( face );
+	}
+
+	void StateCache::BlendFunc( GLenum source, GLenum destination )
+	{
+		if ( state.Known( KnownBlendFunc, state.blendSource == source && state.blendDestination == destination ) ) return;
+
+		state.blendSource = source;
+		state.blendDestination = destination;
+		glBlendFunc( source, destination );
+	}
+
+	void StateCache::BlendEquation( GLenum equation )
+	{
+		if ( state.Known( KnownBlendEquation, state.blendEquation == equation ) ) return;
+
+		state.blendEquation = equation;
+		glBlendEquation( equation );
+	}
+
+	void StateCache::ColorMask( uint mask )
+	{
+		if ( state.Known( KnownColorMask, state.colorMask == mask ) ) return;
+
+		state.colorMask = mask;
+		glColorMask( ( mask & 1 ) != 0, ( mask & 2 ) != 0, ( mask & 4 ) != 0, ( mask & 8 ) != 0 );
+	}
+
+	void StateCache::SetPipelineState( const PipelineState& pipeline )
+	{
+		if ( ( state.known & KnownPipeline ) && state.pipeline == pipeline ) {
+			state.stats.skipped++;
+			return;
+		}
+
+		// Each part is checked against the cache on its own, so only what differs is issued
+		static const Capability::capability_t capabilities[] = {
+			Capability::DepthTest, Capability::StencilTest, Capability::CullFace, Capability::RasterizerDiscard, Capability::Blend
+		};
+		for ( uint i = 0; i < sizeof( capabilities ) / sizeof( capabilities[0] ); i++ )
+			SetCapability( capabilities[i], pipeline.IsEnabled( capabilities[i] ) );
+
+		DepthMask( pipeline.depthMask != 0 );
+		DepthFunc( pipeline.depthFunction );
+		StencilMask( pipeline.stencilMask );
+		StencilFunc( pipeline.stencilFunction, pipeline.stencilReference, pipeline.stencilFuncMask );
+		StencilOp( pipeline.stencilFail, pipeline.stencilZFail, pipeline.stencilPass );
+		CullFace( pipeline.cullFace );
+		BlendFunc( pipeline.blendSource, pipeline.blendDestination );
+		BlendEquation( pipeline.blendEquation );
+		ColorMask( pipeline.colorMask );
+
+		state.pipeline = pipeline;
+		state.known |= KnownPipeline;
+	}
+
+	void StateCache::Viewport( int x, int y, int width, int height )
+	{
+		if ( state.Known( KnownViewport, state.viewport[0] == x && state.viewport[1] == y && state.viewport[2] == width && state.viewport[3] == height ) ) return;
+
+		state.viewport[0] = x;
+		state.viewport[1] = y;
+		state.viewport[2] = width;
+		state.viewport[3] = height;
+		glViewport( x, y, width, height );
+	}
+
+	void StateCache::Invalidate()
+	{
+		state.Forget();
+	}
+
+	StateCache::Stats StateCache::GetStats()
+	{
+		return state.stats;
+	}
+
+	void StateCache::ResetStats()
+	{
+		state.stats = Stats();
+	}
+}
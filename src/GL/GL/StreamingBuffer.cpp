@@ -0,0 +1,113 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/StreamingBuffer.hpp>
+#include <cstring>
+
+namespace GL
+{
+	StreamingBuffer::StreamingBuffer( size_t frameSize, uint frames )
+		: frameSize( frameSize ), frames( frames > 0 ? frames : 1 ), frame( 0 ), used( 0 ), flushed( 0 ), mapping( 0 )
+	{
+		size_t size = frameSize * this->frames;
+		persistent = HasFeature( Feature::BufferStorage );
+		orphan = false;
+
+		if ( persistent ) {
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBindBuffer( GL_ARRAY_BUFFER, m_ID );
+			glBufferStorage( GL_ARRAY_BUFFER, size, 0, flags );
+			mapping = (uchar*)glMapBufferRange( GL_ARRAY_BUFFER, 0, size, flags );
+
+			// Storage can't be resized or orphaned, so falling back takes a new buffer
+			if ( mapping ) fences.resize( this->frames );
+			else VertexBuffer::operator=( VertexBuffer() );
+		}
+
+		if ( !mapping ) {
+			persistent = false;
+			glBindBuffer( GL_ARRAY_BUFFER, m_ID );
+			glBufferData( GL_ARRAY_BUFFER, size, 0, GL_STREAM_DRAW );
+			staging.resize( frameSize );
+		}
+
+		SetFootprint( size );
+	}
+
+	StreamingBuffer::Allocation StreamingBuffer::Allocate( size_t bytes, size_t alignment )
+	{
+		Allocation allocation = { 0, 0 };
+
+		// The offset into the whole buffer is what has to be aligned, regions needn't be
+		size_t base = frame * frameSize;
+		size_t start = used;
+		if ( alignment > 1 ) start = ( base + start + alignment - 1 ) / alignment * alignment - base;
+		if ( start + bytes > frameSize ) return allocation;
+
+		// Only the first allocation in a region can have to wait for the GPU
+		if ( persistent && used == 0 && fences[frame].IsSet() ) {
+			fences[frame].Wait();
+			fences[frame].Reset();
+		}
+
+		used = start + bytes;
+		allocation.offset = base + start;
+		allocation.pointer = persistent ? mapping + allocation.offset : &staging[start];
+
+		return allocation;
+	}
+
+	void StreamingBuffer::Flush()
+	{
+		if ( persistent || flushed == used ) return;
+
+		// Orphaned storage isn't read by earlier draws, so nothing needs to be synchronized
+		if ( orphan ) {
+			glBindBuffer( GL_ARRAY_BUFFER, m_ID );
+			glBufferData( GL_ARRAY_BUFFER, frameSize * frames, 0, GL_STREAM_DRAW );
+			orphan = false;
+		}
+
+		size_t length = used - flushed;
+		void* dst = MapRange( frame * frameSize + flushed, length, MapAccess::Write | MapAccess::InvalidateRange | MapAccess::Unsynchronized );
+		if ( dst ) {
+			memcpy( dst, &staging[flushed], length );
+			Unmap();
+		}
+
+		flushed = used;
+	}
+
+	void StreamingBuffer::EndFrame()
+	{
+		if ( persistent ) {
+			if ( used > 0 ) fences[frame].Insert();
+		} else {
+			Flush();
+		}
+
+		used = flushed = 0;
+		if ( ++frame == frames ) {
+			frame = 0;
+			orphan = !persistent;
+		}
+	}
+}
@@ -1,85 +1,158 @@
-/*
-	Copyright (C) 2012 Alexander Overvoorde
-
-	Permission is hereby granted, free of charge, to any person obtaining a copy of
-	this software and associated documentation files (the "Software"), to deal in
-	the Software without restriction, including without limitation the rights to
-	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
-	the Software, and to permit persons to whom the Software is furnished to do so,
-	subject to the following conditions:
-
-	The above copyright notice and this permission notice shall be included in all
-	copies or substantial portions of the Software.
-
-	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
-	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
-	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
-	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
-	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
-*/
-
-#include <GL/GL/VertexBuffer.hpp>
-#include <vector>
-
-namespace GL
-{
-
-	VertexBuffer::VertexBuffer() {
-		m_ID = gc.Create(m_GeneratorFunc);
-	}
-
-	VertexBuffer::VertexBuffer(const VertexBuffer& rhs) {
-		gc.Copy(m_ID, rhs.m_ID);
-	}
-
-	VertexBuffer::VertexBuffer(const void* data, size_t length, BufferUsage::buffer_usage_t usage){
-		m_ID = gc.Create(m_GeneratorFunc);
-		Data(data, length ,  usage);
-	}
-
-	VertexBuffer::VertexBuffer(const Mesh& mesh, BufferUsage::buffer_usage_t usage, std::function<void(const Vertex& v, VertexDataBuffer& data)> f)
-	{
-		VertexDataBuffer data;
-		const Vertex* vertices = mesh.Vertices();
-		uint count = mesh.VertexCount();
-
-		for (uint i = 0; i < count; i++)
-			f(vertices[i], data);
-
-		m_ID = gc.Create(m_GeneratorFunc);
-		Data(data.Pointer(), data.Size(), usage);
-	}
-
-	VertexBuffer::~VertexBuffer()
-	{
-		gc.Destroy(m_ID, m_DeleterFunc);
-	}
-
-	VertexBuffer::operator GLuint() const {
-		return m_ID;
-	}
-
-	const VertexBuffer& VertexBuffer::operator=(const VertexBuffer& rhs) {
-		gc.Destroy(m_ID, m_DeleterFunc);
-		gc.Copy(m_ID, rhs.m_ID);
-		return *this;
-	}
-
-	void VertexBuffer::Data( const void* data, size_t length, BufferUsage::buffer_usage_t usage ) {
-		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
-		glBufferData(GL_ARRAY_BUFFER, length , data, usage);
-	}
-
-	void VertexBuffer::SubData( const void* data, size_t offset, size_t length ){
-		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
-		glBufferSubData(GL_ARRAY_BUFFER, offset, length, data);
-	}
-
-	void VertexBuffer::GetSubData( void* data, size_t offset, size_t length ) {
-		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
-		glGetBufferSubData(GL_ARRAY_BUFFER, offset, length, data);
-	}
-
-	GC VertexBuffer::gc;
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/GL/VertexBuffer.hpp>
+#include <vector>
+
+namespace GL
+{
+
+	VertexBuffer::VertexBuffer() {
+	}
+
+	VertexBuffer::VertexBuffer(const void* data, size_t length, BufferUsage::buffer_usage_t usage){
+		Data(data, length ,  usage);
+	}
+
+	VertexDataBuffer::VertexDataBuffer()
+		: begin(0), cursor(0), end(0), external(false), overflow(false) {
+	}
+
+	VertexDataBuffer::VertexDataBuffer(size_t capacity)
+		: begin(0), cursor(0), end(0), external(false), overflow(false) {
+		Reserve(capacity);
+	}
+
+	VertexDataBuffer::VertexDataBuffer(void* target, size_t capacity)
+		: begin((uchar*)target), cursor((uchar*)target), end((uchar*)target + capacity), external(true), overflow(false) {
+	}
+
+	void VertexDataBuffer::Reserve(size_t bytes) {
+		if (external || bytes <= Capacity()) return;
+
+		// Left uninitialized, every byte up to the cursor gets written anyway
+		size_t size = Size();
+		std::unique_ptr<uchar[]> grown(new uchar[bytes]);
+		if (size > 0) memcpy(grown.get(), begin, size);
+
+		data.swap(grown);
+		begin = data.get();
+		cursor = begin + size;
+		end = begin + bytes;
+	}
+
+	bool VertexDataBuffer::Grow(size_t count) {
+		if (external) {
+			overflow = true;
+			return false;
+		}
+
+		size_t capacity = Capacity() * 2;
+		if (capacity < Size() + count) capacity = Size() + count;
+		if (capacity < 256) capacity = 256;
+		Reserve(capacity);
+		return true;
+	}
+
+	static void BuildVertices(const Mesh& mesh, VertexDataBuffer& data, const std::function<void(const Vertex& v, VertexDataBuffer& data)>& f) {
+		const Vertex* vertices = mesh.Vertices();
+		uint count = mesh.VertexCount();
+
+		for (uint i = 0; i < count; i++)
+			f(vertices[i], data);
+	}
+
+	VertexBuffer::VertexBuffer(const Mesh& mesh, BufferUsage::buffer_usage_t usage, std::function<void(const Vertex& v, VertexDataBuffer& data)> f)
+	{
+		VertexDataBuffer data;
+		const Vertex* vertices = mesh.Vertices();
+		uint count = mesh.VertexCount();
+
+		// Every vertex is written the same way, so the first one tells how much room the rest need
+		if (count > 0) {
+			f(vertices[0], data);
+			data.Reserve(data.Size() * count);
+		}
+
+		for (uint i = 1; i < count; i++)
+			f(vertices[i], data);
+
+		Data(data.Pointer(), data.Size(), usage);
+	}
+
+	VertexBuffer::VertexBuffer(const Mesh& mesh, size_t stride, BufferUsage::buffer_usage_t usage, std::function<void(const Vertex& v, VertexDataBuffer& data)> f)
+	{
+		size_t length = stride * mesh.VertexCount();
+		Data(0, length, usage);
+
+		void* target = length > 0 ? Map(MapAccess::Write | MapAccess::InvalidateBuffer) : 0;
+		if (target) {
+			VertexDataBuffer data(target, length);
+			BuildVertices(mesh, data, f);
+			if (Unmap() && !data.Overflowed() && data.Size() == length) return;
+		}
+
+		// Mapping failed, the contents were lost or f didn't write exactly stride bytes per vertex, so build it on the CPU after all
+		VertexDataBuffer data(length);
+		BuildVertices(mesh, data, f);
+		Data(data.Pointer(), data.Size(), usage);
+	}
+
+	void VertexBuffer::Data( const void* data, size_t length, BufferUsage::buffer_usage_t usage ) {
+		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+		glBufferData(GL_ARRAY_BUFFER, length , data, usage);
+		SetFootprint(length);
+	}
+
+	void VertexBuffer::SubData( const void* data, size_t offset, size_t length ){
+		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+		glBufferSubData(GL_ARRAY_BUFFER, offset, length, data);
+	}
+
+	void VertexBuffer::GetSubData( void* data, size_t offset, size_t length ) {
+		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+		glGetBufferSubData(GL_ARRAY_BUFFER, offset, length, data);
+	}
+
+	// The footprint is only an estimate for memory accounting, the size of the storage is asked for
+	void* VertexBuffer::Map( MapAccess::map_access_t access ) {
+		GLint size = 0;
+		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+		glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
+		return size > 0 ? MapRange(0, size, access) : 0;
+	}
+
+	void* VertexBuffer::MapRange( size_t offset, size_t length, MapAccess::map_access_t access ) {
+		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+		return glMapBufferRange(GL_ARRAY_BUFFER, offset, length, access);
+	}
+
+	void VertexBuffer::FlushMappedRange( size_t offset, size_t length ) {
+		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+		glFlushMappedBufferRange(GL_ARRAY_BUFFER, offset, length);
+	}
+
+	bool VertexBuffer::Unmap() {
+		glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+		return glUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE;
+	}
+
 }
\ No newline at end of file
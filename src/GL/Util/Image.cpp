@@ -25,6 +25,7 @@
 #endif
 
 #include <GL/Util/Image.hpp>
+#include <GL/Util/Profiler.hpp>
 #include <GL/Util/libjpeg/jpeglib.h>
 #include <GL/Util/libpng/png.h>
 #include <fstream>
@@ -79,13 +80,44 @@ namespace GL
 		Load( filename );
 	}
 
+	Image::Image( Image&& other ) noexcept
+	{
+		image = other.image;
+		width = other.width;
+		height = other.height;
+
+		other.image = 0;
+		other.width = 0;
+		other.height = 0;
+	}
+
 	Image::~Image()
 	{
 		if ( image ) delete [] image;
 	}
 
+	Image& Image::operator=( Image&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			if ( image ) delete [] image;
+
+			image = other.image;
+			width = other.width;
+			height = other.height;
+
+			other.image = 0;
+			other.width = 0;
+			other.height = 0;
+		}
+
+		return *this;
+	}
+
 	void Image::Load( uchar* pixels, uint size )
 	{
+		OOGL_PROFILE_SCOPE( "Image::Load" );
+
 		// Unload image
 		if ( image ) delete[] image;
 		image = 0;
@@ -111,6 +143,8 @@ namespace GL
 
 	void Image::Load( const std::string& filename )
 	{
+		OOGL_PROFILE_SCOPE( "Image::Load" );
+
 		// Unload image
 		if ( image ) delete [] image;
 		image = 0;
@@ -187,6 +221,8 @@ namespace GL
 
 	void Image::LoadBMP( ByteReader& data )
 	{
+		OOGL_PROFILE_SCOPE( "Image::LoadBMP" );
+
 		// BMP header
 		data.Advance( 2 + 4 + 4 ); // Skip magic number, file size and application specific data
 		uint pixelOffset = data.ReadUint();
@@ -276,6 +312,8 @@ namespace GL
 
 	void Image::LoadTGA( ByteReader& data )
 	{
+		OOGL_PROFILE_SCOPE( "Image::LoadTGA" );
+
 		// TGA header
 		data.Advance( 1 ); // Image ID field length, ignored
 		if ( data.ReadUbyte() != 0 ) throw FormatException(); // Color map
@@ -468,6 +506,8 @@ namespace GL
 
 	void Image::LoadJPEG( ByteReader& data )
 	{
+		OOGL_PROFILE_SCOPE( "Image::LoadJPEG" );
+
 		// Initialize structures
 		jpeg_decompress_struct cinfo;
 		jpeg_error_mgr jerr;
@@ -566,6 +606,8 @@ namespace GL
 
 	void Image::LoadPNG( ByteReader& data )
 	{		
+		OOGL_PROFILE_SCOPE( "Image::LoadPNG" );
+
 		// Initialize structures
 		png_structp png = png_create_read_struct( PNG_LIBPNG_VER_STRING, NULL, NULL, NULL );
 		png_infop info = png_create_info_struct( png );
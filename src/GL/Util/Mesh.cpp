@@ -21,6 +21,7 @@
 
 #include <GL/Util/Mesh.hpp>
 #include <GL/Math/Vec3.hpp>
+#include <GL/Util/Profiler.hpp>
 #include <fstream>
 
 namespace GL
@@ -130,6 +131,8 @@ namespace GL
 
 	Mesh::Mesh( const std::string& filename )
 	{
+		OOGL_PROFILE_SCOPE( "Mesh::Mesh" );
+
 		// Read file into memory
 		std::ifstream file( filename.c_str(), std::ios::in | std::ios::ate );
 		if ( !file.is_open() ) throw FileException();
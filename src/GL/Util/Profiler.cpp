@@ -0,0 +1,171 @@
+/*
+	Copyright (C) 2012 Alexander Overvoorde
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
+*/
+
+#include <GL/Util/Profiler.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace GL
+{
+	struct ProfileEvent
+	{
+		const char* name;
+		int64_t start;
+		int64_t end;
+	};
+
+	struct ProfileRing
+	{
+		uint thread;
+		std::atomic<uint64_t> written;
+		ProfileEvent events[Profiler::EventsPerThread];
+	};
+
+	// Rings stay around after their thread exits so its events can still be exported
+	static std::vector<ProfileRing*>& Rings()
+	{
+		static std::vector<ProfileRing*> rings;
+		return rings;
+	}
+
+	static std::mutex& RingsMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	static ProfileRing* RegisterRing()
+	{
+		ProfileRing* ring = new ProfileRing();
+		ring->written = 0;
+
+		std::lock_guard<std::mutex> lock( RingsMutex() );
+		ring->thread = (uint)Rings().size() + 1;
+		Rings().push_back( ring );
+
+		return ring;
+	}
+
+	int64_t Profiler::Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+	}
+
+	// Ticks are related to nanoseconds by sampling both at startup and again on export
+	static const int64_t startTime = Profiler::Now();
+	static const int64_t startTicks = Profiler::Ticks();
+
+	// Constant initialized, so unlike a thread_local with an initializer it needs no guard on every access
+	static thread_local ProfileRing* threadRing = 0;
+
+	void Profiler::Record( const char* name, int64_t startTicks, int64_t endTicks )
+	{
+		ProfileRing* ring = threadRing;
+		if ( !ring ) ring = threadRing = RegisterRing();
+
+		// Only this thread writes the ring, the release makes the event visible before the count
+		uint64_t index = ring->written.load( std::memory_order_relaxed );
+		ProfileEvent& event = ring->events[index % EventsPerThread];
+		event.name = name;
+		event.start = startTicks;
+		event.end = endTicks;
+		ring->written.store( index + 1, std::memory_order_release );
+	}
+
+	// Escapes the characters JSON doesn't allow in strings
+	static void AppendString( std::string& out, const char* str )
+	{
+		out += '"';
+		for ( ; *str; str++ )
+		{
+			if ( *str == '"' || *str == '\\' ) {
+				out += '\\';
+				out += *str;
+			} else if ( (unsigned char)*str < 0x20 ) {
+				char escaped[8];
+				sprintf( escaped, "\\u%04x", *str );
+				out += escaped;
+			} else {
+				out += *str;
+			}
+		}
+		out += '"';
+	}
+
+	std::string Profiler::GetChromeTrace()
+	{
+		std::string out = "{\"traceEvents\":[";
+		bool first = true;
+		char buffer[128];
+
+		int64_t elapsedTicks = Ticks() - startTicks;
+		double nsPerTick = elapsedTicks > 0 ? (double)( Now() - startTime ) / elapsedTicks : 1.0;
+
+		std::lock_guard<std::mutex> lock( RingsMutex() );
+
+		for ( size_t r = 0; r < Rings().size(); r++ )
+		{
+			const ProfileRing* ring = Rings()[r];
+			uint64_t written = ring->written.load( std::memory_order_acquire );
+			uint64_t begin = written > EventsPerThread ? written - EventsPerThread : 0;
+
+			for ( uint64_t i = begin; i < written; i++ )
+			{
+				const ProfileEvent& event = ring->events[i % EventsPerThread];
+
+				if ( !first ) out += ',';
+				first = false;
+
+				out += "{\"name\":";
+				AppendString( out, event.name );
+				sprintf( buffer, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+					ring->thread, ( event.start - startTicks ) * nsPerTick / 1000.0, ( event.end - event.start ) * nsPerTick / 1000.0 );
+				out += buffer;
+			}
+		}
+
+		out += "],\"displayTimeUnit\":\"ms\"}";
+		return out;
+	}
+
+	bool Profiler::WriteChromeTrace( const std::string& filename )
+	{
+		std::ofstream file( filename.c_str(), std::ios::out | std::ios::binary );
+		if ( !file ) return false;
+
+		std::string trace = GetChromeTrace();
+		file.write( trace.c_str(), trace.size() );
+
+		return file.good();
+	}
+
+	void Profiler::Clear()
+	{
+		std::lock_guard<std::mutex> lock( RingsMutex() );
+
+		for ( size_t r = 0; r < Rings().size(); r++ )
+			Rings()[r]->written = 0;
+	}
+}
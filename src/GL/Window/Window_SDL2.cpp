@@ -28,7 +28,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE
 #include <GL/Window/Event.hpp>
 #include <assert.h>
 #include <GL/GL/Context.hpp>
+#include <GL/GL/GC.hpp>
 #include <GL/GL/Error.hpp>
+#include <GL/Util/Profiler.hpp>
 
 namespace GL
 {
@@ -163,6 +165,8 @@ namespace GL
 
 	bool Window::GetEvent(Event& ev)
 	{
+		OOGL_PROFILE_SCOPE("Window::GetEvent");
+
 		// Fetch new events
 		WindowEvent();
 
@@ -177,7 +181,11 @@ namespace GL
 
 	void Window::Present()
 	{
+		OOGL_PROFILE_SCOPE("Window::Present");
+
 		SwapBuffers();
+		if (context) context->EndFrame();
+		else GC::EndFrame();
 	}
 
 	void Window::SwapBuffers() const {